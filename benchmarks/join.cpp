@@ -0,0 +1,181 @@
+// Copyright 2022 Andi Hellmund
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <data_crunching/dataframe.hpp>
+
+using DataFrameLeft = dacr::DataFrame<
+    dacr::Column<"id", int>,
+    dacr::Column<"value", double>
+>;
+
+using DataFrameRight = dacr::DataFrame<
+    dacr::Column<"id", int>,
+    dacr::Column<"name", std::string>
+>;
+
+using DataFrameWide = dacr::DataFrame<
+    dacr::Column<"id", int>,
+    dacr::Column<"text1", std::string>,
+    dacr::Column<"text2", std::string>,
+    dacr::Column<"text3", std::string>,
+    dacr::Column<"value", double>
+>;
+
+// the nested loop join is quadratic: above this size its runtime is extrapolated
+static constexpr std::size_t MAX_ROWS_NESTED_LOOP = 100'000;
+
+template <typename Func>
+double measureSeconds (Func&& func) {
+    const auto start = std::chrono::steady_clock::now();
+    func();
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(end - start).count();
+}
+
+std::vector<int> getShuffledIds (std::size_t num_rows, std::mt19937& generator) {
+    std::vector<int> ids(num_rows);
+    std::iota(ids.begin(), ids.end(), 0);
+    std::shuffle(ids.begin(), ids.end(), generator);
+    return ids;
+}
+
+int main (int argc, char *argv[]) {
+    std::mt19937 generator{42};
+    double nested_loop_seconds_per_row_pair {0};
+
+    std::cout << std::setw(10) << "rows" << std::setw(16) << "hash [s]" << std::setw(18) << "partitioned [s]" << std::setw(18) << "sort-merge [s]" << std::setw(20) << "nested loop [s]" << std::setw(12) << "matches" << "\n";
+    for (std::size_t num_rows : {10'000, 100'000, 1'000'000}) {
+        DataFrameLeft df_left{};
+        std::vector<double> values(num_rows, 1.0);
+        df_left.insertRanges(getShuffledIds(num_rows, generator), values);
+
+        DataFrameRight df_right{};
+        std::vector<std::string> names(num_rows, "some name beyond short string optimization");
+        df_right.insertRanges(getShuffledIds(num_rows, generator), names);
+
+        std::size_t num_matches {0};
+        const double hash_seconds = measureSeconds([&]() {
+            num_matches = df_left.join<dacr::Join::Inner, "id">(df_right).getSize();
+        });
+
+        const double partitioned_seconds = measureSeconds([&]() {
+            (void)df_left.join<dacr::Join::Inner, "id">(df_right, {.strategy = dacr::JoinStrategy::PartitionedHash});
+        });
+
+        // sorting is not part of the measurement: sort-merge targets already sorted input
+        auto df_left_sorted = df_left.sort<dacr::SortOrder::Ascending, "id">();
+        auto df_right_sorted = df_right.sort<dacr::SortOrder::Ascending, "id">();
+        const double sort_merge_seconds = measureSeconds([&]() {
+            (void)df_left_sorted.join<dacr::Join::Inner, "id">(df_right_sorted, {.strategy = dacr::JoinStrategy::SortMerge});
+        });
+
+        std::cout << std::setw(10) << num_rows << std::setw(16) << hash_seconds << std::setw(18) << partitioned_seconds << std::setw(18) << sort_merge_seconds;
+        if (num_rows <= MAX_ROWS_NESTED_LOOP) {
+            const double nested_loop_seconds = measureSeconds([&]() {
+                (void)df_left.join<dacr::Join::Inner, "id">(df_right, {.strategy = dacr::JoinStrategy::NestedLoop});
+            });
+            nested_loop_seconds_per_row_pair = nested_loop_seconds / (static_cast<double>(num_rows) * num_rows);
+            std::cout << std::setw(20) << nested_loop_seconds;
+        }
+        else {
+            const double estimated_seconds = nested_loop_seconds_per_row_pair * num_rows * num_rows;
+            std::cout << std::setw(20) << ("~" + std::to_string(estimated_seconds));
+        }
+        std::cout << std::setw(12) << num_matches << "\n";
+    }
+
+    // late materialization: only two of the columns of a wide DataFrame are needed after the join
+    std::cout << "\n" << std::setw(10) << "rows" << std::setw(16) << "join [s]" << std::setw(26) << "joinRows+materialize [s]" << "\n";
+    for (std::size_t num_rows : {100'000, 1'000'000}) {
+        DataFrameWide df_wide{};
+        std::vector<std::string> texts(num_rows, "some text beyond short string optimization");
+        std::vector<double> values(num_rows, 1.0);
+        df_wide.insertRanges(getShuffledIds(num_rows, generator), texts, texts, texts, values);
+
+        DataFrameLeft df_left{};
+        df_left.insertRanges(getShuffledIds(num_rows, generator), values);
+        auto df_ids = df_left.select<"id">();
+
+        const double join_seconds = measureSeconds([&]() {
+            (void)df_ids.join<dacr::Join::Inner, "id">(df_wide).select<"id", "value">();
+        });
+        const double late_seconds = measureSeconds([&]() {
+            (void)df_ids.joinRows<dacr::Join::Inner, "id">(df_wide).materialize<"id", "value">();
+        });
+        std::cout << std::setw(10) << num_rows << std::setw(16) << join_seconds << std::setw(26) << late_seconds << "\n";
+    }
+
+    // repeated joins of small batches against the same large DataFrame
+    static constexpr std::size_t NUM_BATCHES = 100;
+    static constexpr std::size_t BATCH_SIZE = 1'000;
+    std::cout << "\n" << std::setw(10) << "rows" << std::setw(10) << "batches" << std::setw(16) << "join [s]" << std::setw(22) << "join index [s]" << "\n";
+    for (std::size_t num_rows : {100'000, 1'000'000}) {
+        DataFrameRight df_dimension{};
+        std::vector<std::string> names(num_rows, "some name beyond short string optimization");
+        df_dimension.insertRanges(getShuffledIds(num_rows, generator), names);
+
+        std::vector<DataFrameLeft> batches(NUM_BATCHES);
+        std::uniform_int_distribution<int> id_distribution{0, static_cast<int>(num_rows) - 1};
+        for (auto& batch : batches) {
+            for (auto i = 0LU; i < BATCH_SIZE; ++i) {
+                batch.insert(id_distribution(generator), 1.0);
+            }
+        }
+
+        const double join_seconds = measureSeconds([&]() {
+            for (const auto& batch : batches) {
+                (void)batch.join<dacr::Join::Inner, "id">(df_dimension);
+            }
+        });
+        const double join_index_seconds = measureSeconds([&]() {
+            auto join_index = df_dimension.buildJoinIndex<"id">();
+            for (const auto& batch : batches) {
+                (void)batch.join<dacr::Join::Inner>(join_index);
+            }
+        });
+        std::cout << std::setw(10) << num_rows << std::setw(10) << NUM_BATCHES << std::setw(16) << join_seconds << std::setw(22) << join_index_seconds << "\n";
+    }
+
+    // selective joins: only 1% of the rows of the large DataFrame find a match
+    std::cout << "\n" << std::setw(10) << "rows" << std::setw(12) << "build rows" << std::setw(20) << "no bloom filter [s]" << std::setw(20) << "bloom filter [s]" << "\n";
+    for (std::size_t num_rows : {1'000'000, 10'000'000}) {
+        const std::size_t num_build_rows = num_rows / 100;
+        DataFrameLeft df_probe{};
+        std::vector<double> values(num_rows, 1.0);
+        df_probe.insertRanges(getShuffledIds(num_rows, generator), values);
+
+        DataFrameRight df_build{};
+        std::vector<std::string> names(num_build_rows, "name");
+        std::vector<int> build_ids(num_build_rows);
+        std::iota(build_ids.begin(), build_ids.end(), 0);
+        df_build.insertRanges(build_ids, names);
+
+        const double no_bloom_filter_seconds = measureSeconds([&]() {
+            (void)df_probe.join<dacr::Join::Inner, "id">(df_build, {.bloom_filter = dacr::JoinBloomFilter::Disabled});
+        });
+        const double bloom_filter_seconds = measureSeconds([&]() {
+            (void)df_probe.join<dacr::Join::Inner, "id">(df_build, {.bloom_filter = dacr::JoinBloomFilter::Enabled});
+        });
+        std::cout << std::setw(10) << num_rows << std::setw(12) << num_build_rows << std::setw(20) << no_bloom_filter_seconds << std::setw(20) << bloom_filter_seconds << "\n";
+    }
+}
@@ -0,0 +1,153 @@
+// Copyright 2022 Andi Hellmund
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <data_crunching/dataframe.hpp>
+
+using DataFrameSummarize = dacr::DataFrame<
+    dacr::Column<"user_id", int>,
+    dacr::Column<"amount", double>
+>;
+
+template <typename Func>
+double measureSeconds (Func&& func) {
+    const auto start = std::chrono::steady_clock::now();
+    func();
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(end - start).count();
+}
+
+DataFrameSummarize createDataFrame (std::size_t num_rows, std::size_t num_groups, std::mt19937& generator) {
+    std::uniform_int_distribution<int> user_id_distribution{0, static_cast<int>(num_groups) - 1};
+    std::uniform_real_distribution<double> amount_distribution{0.0, 100.0};
+    std::vector<int> user_ids(num_rows);
+    std::vector<double> amounts(num_rows);
+    for (auto i = 0LU; i < num_rows; ++i) {
+        user_ids[i] = user_id_distribution(generator);
+        amounts[i] = amount_distribution(generator);
+    }
+    DataFrameSummarize df{};
+    df.insertRanges(user_ids, amounts);
+    return df;
+}
+
+int main (int argc, char *argv[]) {
+    std::mt19937 generator{42};
+
+    std::cout << std::setw(10) << "rows" << std::setw(10) << "groups" << std::setw(20) << "group-by [s]" << std::setw(20) << "sorted runs [s]" << std::setw(20) << "key domain [s]" << "\n";
+    for (auto [num_rows, num_groups] : {std::pair{1'000'000LU, 1'000LU}, std::pair{1'000'000LU, 500'000LU}, std::pair{10'000'000LU, 500'000LU}}) {
+        auto df = createDataFrame(num_rows, num_groups, generator);
+        auto sorted_df = df.sort<dacr::SortOrder::Ascending, "user_id">();
+        const double group_by_seconds = measureSeconds([&]() {
+            (void)df.summarize<dacr::GroupBy<"user_id">, dacr::Sum<"amount", "amount_sum">, dacr::Max<"amount", "amount_max">>();
+        });
+        const double sorted_runs_seconds = measureSeconds([&]() {
+            (void)sorted_df.summarize<dacr::GroupBy<"user_id">, dacr::Sum<"amount", "amount_sum">, dacr::Max<"amount", "amount_max">>({
+                .strategy = dacr::SummarizeStrategy::SortedRuns
+            });
+        });
+        const double key_domain_seconds = measureSeconds([&]() {
+            (void)df.summarize<dacr::GroupByDomain<"user_id", 0, 500'000>, dacr::Sum<"amount", "amount_sum">, dacr::Max<"amount", "amount_max">>();
+        });
+        std::cout << std::setw(10) << num_rows << std::setw(10) << num_groups << std::setw(20) << group_by_seconds << std::setw(20) << sorted_runs_seconds << std::setw(20) << key_domain_seconds << "\n";
+    }
+
+    // nearly every row is a group of its own, such that the blocks of rows are merged group by group
+    std::cout << "\n" << std::setw(10) << "rows" << std::setw(10) << "groups" << std::setw(20) << "1 thread [s]" << std::setw(20) << "4 threads [s]" << "\n";
+    for (auto [num_rows, num_groups] : {std::pair{10'000'000LU, 10'000'000LU}}) {
+        auto df = createDataFrame(num_rows, num_groups, generator);
+        auto summarize = [&](std::size_t num_threads) {
+            return measureSeconds([&]() {
+                (void)df.summarize<dacr::GroupBy<"user_id">, dacr::Sum<"amount", "amount_sum">, dacr::Max<"amount", "amount_max">>({.num_threads = num_threads});
+            });
+        };
+        const double serial_seconds = summarize(1);
+        const double parallel_seconds = summarize(4);
+        std::cout << std::setw(10) << num_rows << std::setw(10) << num_groups << std::setw(20) << serial_seconds << std::setw(20) << parallel_seconds << "\n";
+    }
+
+    std::cout << "\n" << std::setw(10) << "rows" << std::setw(20) << "no group-by [s]" << "\n";
+    for (auto num_rows : {10'000'000LU, 100'000'000LU}) {
+        auto df = createDataFrame(num_rows, 1, generator);
+        const double no_group_by_seconds = measureSeconds([&]() {
+            (void)df.summarize<
+                dacr::GroupByNone,
+                dacr::Sum<"amount", "amount_sum">,
+                dacr::Min<"amount", "amount_min">,
+                dacr::Max<"amount", "amount_max">,
+                dacr::Avg<"user_id", "user_id_avg">
+            >();
+        });
+        std::cout << std::setw(10) << num_rows << std::setw(20) << no_group_by_seconds << "\n";
+    }
+
+    std::cout << "\n" << std::setw(10) << "rows" << std::setw(10) << "groups" << std::setw(20) << "statistics [s]" << "\n";
+    for (auto [num_rows, num_groups] : {std::pair{10'000'000LU, 1'000LU}, std::pair{10'000'000LU, 500'000LU}}) {
+        auto df = createDataFrame(num_rows, num_groups, generator);
+        const double statistics_seconds = measureSeconds([&]() {
+            (void)df.summarize<
+                dacr::GroupBy<"user_id">,
+                dacr::Sum<"amount", "amount_sum">,
+                dacr::Avg<"amount", "amount_avg">,
+                dacr::StdDev<"amount", "amount_stddev">,
+                dacr::Min<"amount", "amount_min">,
+                dacr::Max<"amount", "amount_max">
+            >();
+        });
+        std::cout << std::setw(10) << num_rows << std::setw(10) << num_groups << std::setw(20) << statistics_seconds << "\n";
+    }
+
+    std::cout << "\n" << std::setw(10) << "rows" << std::setw(10) << "groups" << std::setw(20) << "rollup [s]" << std::setw(20) << "separate [s]" << "\n";
+    for (auto [num_rows, num_groups] : {std::pair{10'000'000LU, 1'000LU}, std::pair{10'000'000LU, 500'000LU}}) {
+        auto df = createDataFrame(num_rows, num_groups, generator);
+        const double rollup_seconds = measureSeconds([&]() {
+            (void)df.summarize<dacr::Rollup<"user_id">, dacr::Sum<"amount", "amount_sum">, dacr::Max<"amount", "amount_max">>();
+        });
+        const double separate_seconds = measureSeconds([&]() {
+            (void)df.summarize<dacr::GroupBy<"user_id">, dacr::Sum<"amount", "amount_sum">, dacr::Max<"amount", "amount_max">>();
+            (void)df.summarize<dacr::GroupByNone, dacr::Sum<"amount", "amount_sum">, dacr::Max<"amount", "amount_max">>();
+        });
+        std::cout << std::setw(10) << num_rows << std::setw(10) << num_groups << std::setw(20) << rollup_seconds << std::setw(20) << separate_seconds << "\n";
+    }
+
+    std::cout << "\n" << std::setw(10) << "rows" << std::setw(10) << "window" << std::setw(20) << "rolling [s]" << std::setw(20) << "partitioned [s]" << "\n";
+    {
+        auto df = createDataFrame(10'000'000LU, 1'000LU, generator);
+        auto measureRolling = [&]<std::size_t WindowSize>() {
+            const double rolling_seconds = measureSeconds([&]() {
+                (void)df.rolling<dacr::Window<WindowSize>, dacr::Avg<"amount", "amount_avg">, dacr::Max<"amount", "amount_max">>();
+            });
+            const double partitioned_seconds = measureSeconds([&]() {
+                (void)df.rolling<dacr::Window<WindowSize, "user_id">, dacr::Avg<"amount", "amount_avg">, dacr::Max<"amount", "amount_max">>();
+            });
+            std::cout << std::setw(10) << df.getSize() << std::setw(10) << WindowSize << std::setw(20) << rolling_seconds << std::setw(20) << partitioned_seconds << "\n";
+        };
+        measureRolling.template operator()<10>();
+        measureRolling.template operator()<10'000>();
+    }
+
+    std::cout << "\n" << std::setw(10) << "rows" << std::setw(10) << "groups" << std::setw(20) << "quantiles [s]" << "\n";
+    for (auto [num_rows, num_groups] : {std::pair{10'000'000LU, 1LU}, std::pair{10'000'000LU, 1'000LU}}) {
+        auto df = createDataFrame(num_rows, num_groups, generator);
+        const double quantile_seconds = measureSeconds([&]() {
+            (void)df.summarize<dacr::GroupBy<"user_id">, dacr::Median<"amount", "amount_p50">, dacr::Quantile<"amount", "amount_p99", 99>>();
+        });
+        std::cout << std::setw(10) << num_rows << std::setw(10) << num_groups << std::setw(20) << quantile_seconds << "\n";
+    }
+}
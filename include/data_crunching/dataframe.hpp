@@ -15,20 +15,37 @@
 #ifndef DATA_CRUNCHING_DATAFRAME_HPP
 #define DATA_CRUNCHING_DATAFRAME_HPP
 
+#include <algorithm>
 #include <ranges>
 #include <vector>
 #include <iostream>
 
+#include "data_crunching/internal/bloom_filter.hpp"
 #include "data_crunching/internal/dataframe_general.hpp"
+#include "data_crunching/internal/dataframe_grouping_sets.hpp"
+#include "data_crunching/internal/dataframe_join.hpp"
 #include "data_crunching/internal/dataframe_print.hpp"
+#include "data_crunching/internal/dataframe_rolling.hpp"
 #include "data_crunching/internal/dataframe_sort.hpp"
 #include "data_crunching/internal/dataframe_summarize.hpp"
+#include "data_crunching/internal/dataframe_window.hpp"
 #include "data_crunching/internal/column.hpp"
+#include "data_crunching/internal/hash.hpp"
 #include "data_crunching/internal/name_list.hpp"
+#include "data_crunching/internal/parallel.hpp"
 #include "data_crunching/internal/type_list.hpp"
 
 namespace dacr {
 
+template <typename DataFrameLhs, typename DataFrameRhs, typename JoinedDataFrame>
+class JoinedRows;
+
+template <typename IndexedDataFrame, FixedString ...JoinNames>
+class JoinIndex;
+
+template <typename SummarizedDataFrame, typename GroupBy, typename ...Ops>
+class MaterializedSummary;
+
 template <internal::IsColumn ...Columns>
 requires (
     internal::are_names_unique<internal::GetColumnNames<Columns...>> and
@@ -43,6 +60,21 @@ public:
     )
     friend class DataFrame;
 
+    template <typename, typename, typename>
+    friend class JoinedRows;
+
+    template <typename, FixedString ...>
+    friend class JoinIndex;
+
+    template <typename, typename, typename ...>
+    friend class MaterializedSummary;
+
+    template <typename, typename, typename, typename, SummarizeStrategy, typename>
+    friend class internal::SummarizationExecuterGroupBy;
+
+    template <typename, typename, typename, typename, typename>
+    friend class internal::GroupingSetsExecuter;
+
     DataFrame() = default;
 
     // ############################################################################
@@ -184,34 +216,98 @@ public:
     // API: Join
     // ############################################################################
     template <Join JoinType, FixedString ...JoinNames, typename ...OtherColumns>
-    requires (sizeof...(JoinNames) > 0 &&
-        internal::are_names_unique<internal::NameList<JoinNames...>> &&
-        internal::are_names_in_columns<internal::NameList<JoinNames...>, Columns...> &&
-        internal::are_names_in_columns<internal::NameList<JoinNames...>, Columns...> &&
-        internal::are_names_unique<
-            internal::NameListMerge<
-                internal::NameListDifference<internal::GetColumnNames<Columns...>, internal::NameList<JoinNames...>>,
-                internal::NameListDifference<internal::GetColumnNames<OtherColumns...>, internal::NameList<JoinNames...>>
-            >
-        > &&
-        internal::are_columns_the_same_in_two_lists_by_names<internal::NameList<JoinNames...>, TypeList<Columns...>, TypeList<OtherColumns...>>
-    )
-    auto join (const DataFrame<OtherColumns...>& df) {
-        if constexpr (sizeof...(Columns) > 0) {
-            // compute all the indices
+    requires (internal::is_valid_join<JoinType, internal::NameList<JoinNames...>, TypeList<Columns...>, TypeList<OtherColumns...>>)
+    auto join (const DataFrame<OtherColumns...>& df, const JoinOptions& join_options = JoinOptions{}) const {
+        if constexpr (internal::is_filtering_join<JoinType>) {
+            using JoinTypes = internal::GetColumnTypesByNames<internal::NameList<JoinNames...>, Columns...>;
             using JoinIndicesSelf = internal::GetColumnIndicesByNames<internal::NameList<JoinNames...>, Columns...>;
             using JoinIndicesOther = internal::GetColumnIndicesByNames<internal::NameList<JoinNames...>, OtherColumns...>;
-            using ColumnNamesToCopyOther = internal::NameListDifference<internal::GetColumnNames<OtherColumns...>, internal::NameList<JoinNames...>>;
-            using DataIndicesToCopyOther = internal::GetColumnIndicesByNames<ColumnNamesToCopyOther, OtherColumns...>;
+            return filterRowsByMatch<JoinType>(computeHasMatch<JoinTypes, JoinIndicesSelf, JoinIndicesOther>(df, join_options));
+        }
+        else {
+            return joinRows<JoinType, JoinNames...>(df, join_options).materialize();
+        }
+    }
 
-            using DataIndicesInResultOther = internal::IntegerSequenceByRange<sizeof...(Columns), sizeof...(Columns) + sizeof...(OtherColumns) - sizeof...(JoinNames)>;
-            using JoinedDataFrame = internal::DataFrameMerge<DataFrame, internal::GetDataFrameWithColumnsByName<ColumnNamesToCopyOther, OtherColumns...>>;
-            
-            return joinImpl<JoinType, JoinedDataFrame, JoinIndicesSelf, JoinIndicesOther, DataIndicesInResultOther, DataIndicesToCopyOther>(df);
+    /**
+     * Determines the matching rows of a join without copying any column data. The columns
+     * are copied on demand by JoinedRows::materialize.
+    */
+    template <Join JoinType, FixedString ...JoinNames, typename ...OtherColumns>
+    requires (
+        not internal::is_filtering_join<JoinType> &&
+        internal::is_valid_join<JoinType, internal::NameList<JoinNames...>, TypeList<Columns...>, TypeList<OtherColumns...>>
+    )
+    auto joinRows (const DataFrame<OtherColumns...>& df, const JoinOptions& join_options = JoinOptions{}) const {
+        using JoinTypes = internal::GetColumnTypesByNames<internal::NameList<JoinNames...>, Columns...>;
+        using JoinIndicesSelf = internal::GetColumnIndicesByNames<internal::NameList<JoinNames...>, Columns...>;
+        using JoinIndicesOther = internal::GetColumnIndicesByNames<internal::NameList<JoinNames...>, OtherColumns...>;
+        using JoinedDataFrame = internal::GetJoinedDataFrame<internal::NameList<JoinNames...>, DataFrame, OtherColumns...>;
+
+        const std::size_t num_threads = join_options.strategy == JoinStrategy::PartitionedHash ? join_options.num_threads : 1;
+        return JoinedRows<DataFrame, DataFrame<OtherColumns...>, JoinedDataFrame>{
+            *this,
+            df,
+            computeJoinMatches<JoinType, JoinTypes, JoinIndicesSelf, JoinIndicesOther>(df, join_options),
+            num_threads
+        };
+    }
+
+    /**
+     * Joins with the DataFrame indexed by join_index, whose hash table is reused instead of
+     * being built per call. Rows appended to the indexed DataFrame are added to the index first.
+    */
+    template <Join JoinType, FixedString ...JoinNames, typename ...OtherColumns>
+    requires (
+        JoinType != Join::AsOf &&
+        internal::is_valid_join<JoinType, internal::NameList<JoinNames...>, TypeList<Columns...>, TypeList<OtherColumns...>>
+    )
+    auto join (JoinIndex<DataFrame<OtherColumns...>, JoinNames...>& join_index) const {
+        if constexpr (internal::is_filtering_join<JoinType>) {
+            using JoinIndicesSelf = internal::GetColumnIndicesByNames<internal::NameList<JoinNames...>, Columns...>;
+            join_index.update();
+            std::vector<char> has_match(getSize(), 0);
+            for (auto row_index = 0LU; row_index < getSize(); ++row_index) {
+                has_match[row_index] = join_index.containsMatch(column_store_data_, row_index, JoinIndicesSelf{});
+            }
+            return filterRowsByMatch<JoinType>(has_match);
         }
         else {
-            return DataFrame{};
+            return joinRows<JoinType, JoinNames...>(join_index).materialize();
+        }
+    }
+
+    template <Join JoinType, FixedString ...JoinNames, typename ...OtherColumns>
+    requires (
+        JoinType == Join::Inner &&
+        internal::is_valid_join<JoinType, internal::NameList<JoinNames...>, TypeList<Columns...>, TypeList<OtherColumns...>>
+    )
+    auto joinRows (JoinIndex<DataFrame<OtherColumns...>, JoinNames...>& join_index) const {
+        using JoinIndicesSelf = internal::GetColumnIndicesByNames<internal::NameList<JoinNames...>, Columns...>;
+        using JoinedDataFrame = internal::GetJoinedDataFrame<internal::NameList<JoinNames...>, DataFrame, OtherColumns...>;
+
+        join_index.update();
+        internal::JoinMatches matches {};
+        for (auto row_index = 0LU; row_index < getSize(); ++row_index) {
+            join_index.forEachMatch(column_store_data_, row_index, JoinIndicesSelf{}, [&](std::size_t row_index_other) {
+                matches.add(row_index, row_index_other);
+            });
         }
+        return JoinedRows<DataFrame, DataFrame<OtherColumns...>, JoinedDataFrame>{*this, join_index.getDataFrame(), std::move(matches), 1};
+    }
+
+    /**
+     * Builds a hash index on the join columns to be reused by multiple joins with this DataFrame.
+    */
+    template <FixedString ...JoinNames>
+    requires (
+        sizeof...(JoinNames) > 0 &&
+        internal::are_names_unique<internal::NameList<JoinNames...>> &&
+        internal::are_names_in_columns<internal::NameList<JoinNames...>, Columns...> &&
+        internal::are_types_hashable<internal::GetColumnTypesByNames<internal::NameList<JoinNames...>, Columns...>>
+    )
+    auto buildJoinIndex () const {
+        return JoinIndex<DataFrame, JoinNames...>{*this};
     }
 
     // ############################################################################
@@ -220,41 +316,144 @@ public:
     template <internal::IsGroupBySpec GroupBy, internal::IsSummarizeOp ...Ops>
     requires (internal::are_valid_summarize_ops<TypeList<Ops...>, Columns...>)
     // ToDo group-by names are not part of summarize-ops
-    auto summarize () {
+    auto summarize (const SummarizeOptions& summarize_options = SummarizeOptions{}) const {
         if constexpr (sizeof...(Columns) > 0) {
-            if constexpr (GroupBy::NumColumns == 0) {
-                using CompoundSummarizer = internal::GetCompoundSummarizer<TypeList<Ops...>, Columns...>;
-                using NewDataFrame = typename internal::GetNewColumnsForOps<TypeList<Ops...>, Columns...>::template To<DataFrame>;
-                
-                using Executer = internal::SummarizationExecuterNoGroupBy<NewDataFrame, CompoundSummarizer>;
-                Executer executer{};
-                for (std::size_t loop_index = 0; loop_index < getSize(); ++loop_index) {
-                    executer.summarize(column_store_data_, loop_index);
-                }
-                return executer.constructResult();
-            }
-            else {
-                using GroupByIndices = internal::GetColumnIndicesByNames<typename GroupBy::Names, Columns...>;
-                using GroupByTypes = typename internal::GetColumnTypesByNames<typename GroupBy::Names, Columns...>::template To<std::tuple>;
-
-                using CompoundSummarizer = internal::GetCompoundSummarizer<TypeList<Ops...>, Columns...>;
-                using DataFrameGroupBy = internal::GetDataFrameWithColumnsByName<typename GroupBy::Names, Columns...>;
-                using DataFrameOps = typename internal::GetNewColumnsForOps<TypeList<Ops...>, Columns...>::template To<DataFrame>;
-                using NewDataFrame = internal::DataFrameMerge<DataFrameGroupBy, DataFrameOps>;
-                
-                using Executer = internal::SummarizationExecuterGroupBy<NewDataFrame, GroupByIndices, GroupByTypes, CompoundSummarizer>;
-                Executer executer{};
-                for (std::size_t loop_index = 0; loop_index < getSize(); ++loop_index) {
-                    executer.summarize(column_store_data_, loop_index);
-                }
-                return executer.constructResult();
-            }
+            using CompoundSummarizer = internal::GetCompoundSummarizer<TypeList<Ops...>, Columns...>;
+            using DataFrameGroupBy = internal::GetDataFrameWithColumnsByName<typename GroupBy::Names, Columns...>;
+            using DataFrameOps = typename internal::GetNewColumnsForOps<TypeList<Ops...>, Columns...>::template To<DataFrame>;
+            using NewDataFrame = std::conditional_t<GroupBy::NumColumns == 0, DataFrameOps, internal::DataFrameMerge<DataFrameGroupBy, DataFrameOps>>;
+
+            return withSummarizationExecuter<GroupBy, CompoundSummarizer, NewDataFrame>(summarize_options, [&]<typename Executer>() {
+                return internal::executeSummarization<Executer>(column_store_data_, getSize(), summarize_options.num_threads);
+            });
         }
         else {
             return DataFrame{};
         }
     }
 
+    /**
+     * Summarizes the rows by multiple grouping sets (e.g. a rollup) in a single scan. The column
+     * grouping_set holds the index of the set of each group.
+    */
+    template <internal::IsGroupingSetsSpec GroupingSetsSpec, internal::IsSummarizeOp ...Ops>
+    requires (
+        sizeof...(Columns) > 0 &&
+        internal::are_valid_summarize_ops<TypeList<Ops...>, Columns...> &&
+        internal::are_names_in_columns<internal::GetGroupingSetsNames<GroupingSetsSpec>, Columns...>
+    )
+    auto summarize (const SummarizeOptions& summarize_options = SummarizeOptions{}) const {
+        using KeyNames = internal::GetGroupingSetsNames<GroupingSetsSpec>;
+        using CompoundSummarizer = internal::GetCompoundSummarizer<TypeList<Ops...>, Columns...>;
+        using DataFrameKeys = internal::DataFrameAppend<Column<"grouping_set", std::size_t>, internal::GetDataFrameWithColumnsByName<KeyNames, Columns...>>;
+        using DataFrameOps = typename internal::GetNewColumnsForOps<TypeList<Ops...>, Columns...>::template To<DataFrame>;
+        using NewDataFrame = internal::DataFrameMerge<DataFrameKeys, DataFrameOps>;
+        using KeyColumnIndices = internal::GetColumnIndicesByNames<KeyNames, Columns...>;
+        using KeyTypes = typename internal::GetColumnTypesByNames<KeyNames, Columns...>::template To<std::tuple>;
+
+        return internal::GroupingSetsExecuter<NewDataFrame, KeyColumnIndices, KeyTypes, internal::GetGroupingSetKeyIndices<GroupingSetsSpec>, CompoundSummarizer>::execute(
+            column_store_data_, getSize(), summarize_options
+        );
+    }
+
+    /**
+     * Selects the rows with the K largest (or smallest for ascending order) values of a column
+     * per group. The rows are ordered by group (in the order of the first appearance) and by
+     * value from best to worst.
+    */
+    template <internal::IsGroupBySpec GroupBy, FixedString ColumnName, std::size_t K, SortOrder Order = SortOrder::Descending>
+    requires (
+        K > 0 &&
+        internal::are_names_in_columns<typename GroupBy::Names, Columns...> &&
+        internal::is_name_in_columns<ColumnName, Columns...> &&
+        internal::IsLessThanComparable<internal::GetColumnTypeByName<ColumnName, Columns...>>
+    )
+    DataFrame topKPerGroup (const SummarizeOptions& summarize_options = SummarizeOptions{}) const {
+        using SummarizerTopK = internal::SummarizerTopK<internal::get_column_index_by_name<ColumnName, Columns...>, internal::GetColumnTypeByName<ColumnName, Columns...>, K, Order>;
+        using CompoundSummarizer = internal::CompoundSummarizer<SummarizerTopK>;
+
+        // the executers construct no result DataFrame: the rows are selected by the summarizer states
+        return withSummarizationExecuter<GroupBy, CompoundSummarizer, void>(summarize_options, [&]<typename Executer>() {
+            Executer executer{};
+            internal::summarizeRows(executer, column_store_data_, 0, getSize(), summarize_options.num_threads);
+
+            std::vector<std::size_t> row_indices{};
+            for (const auto& summarizer_data : executer.getSummarizerData()) {
+                const auto group_row_indices = std::get<0>(summarizer_data).getState();
+                row_indices.insert(row_indices.end(), group_row_indices.begin(), group_row_indices.end());
+            }
+            return gatherRows(row_indices, IndicesForColumnStore{});
+        });
+    }
+
+    /**
+     * Builds a summary that is maintained incrementally while rows are appended to this DataFrame,
+     * such that a refresh only summarizes the new rows (see MaterializedSummary).
+    */
+    template <internal::IsGroupBySpec GroupBy, internal::IsSummarizeOp ...Ops>
+    requires (
+        sizeof...(Columns) > 0 &&
+        internal::are_valid_summarize_ops<TypeList<Ops...>, Columns...> &&
+        internal::are_incremental_summarize_ops<TypeList<Ops...>>
+    )
+    auto materializeSummary (const SummarizeOptions& summarize_options = SummarizeOptions{}) const {
+        return MaterializedSummary<DataFrame, GroupBy, Ops...>{*this, summarize_options};
+    }
+
+    // ############################################################################
+    // API: Rolling
+    // ############################################################################
+    /**
+     * Extends the DataFrame by one column per op, aggregating the op over the window of each row.
+    */
+    template <internal::IsWindowSpec WindowSpec, internal::IsSummarizeOp ...Ops>
+    requires (
+        sizeof...(Columns) > 0 &&
+        sizeof...(Ops) > 0 &&
+        internal::are_names_unique<typename WindowSpec::Names> &&
+        internal::are_names_in_columns<typename WindowSpec::Names, Columns...> &&
+        internal::are_valid_summarize_ops<TypeList<Ops...>, Columns...> &&
+        internal::are_rolling_ops<TypeList<Ops...>>
+    )
+    auto rolling () const {
+        using PartitionColumnIndices = internal::GetColumnIndicesByNames<typename WindowSpec::Names, Columns...>;
+        using PartitionTypes = typename internal::GetColumnTypesByNames<typename WindowSpec::Names, Columns...>::template To<std::tuple>;
+        using DataFrameOps = typename internal::GetNewColumnsForOps<TypeList<Ops...>, Columns...>::template To<DataFrame>;
+        using NewDataFrame = internal::DataFrameMerge<DataFrame, DataFrameOps>;
+        using Computation = internal::RollingComputation<WindowSpec, PartitionColumnIndices, PartitionTypes, TypeList<Ops...>, Columns...>;
+
+        NewDataFrame result;
+        result.column_store_data_ = std::tuple_cat(column_store_data_, Computation::compute(column_store_data_, getSize()));
+        return result;
+    }
+
+    // ############################################################################
+    // API: Window
+    // ############################################################################
+    /**
+     * Extends the DataFrame by one column per window op, evaluated over the rows of the partition
+     * of each row in the order of the order-by columns.
+    */
+    template <internal::IsPartitionBySpec PartitionBySpec, internal::IsOrderBySpec OrderBySpec, internal::IsWindowOp ...Ops>
+    requires (
+        sizeof...(Columns) > 0 &&
+        sizeof...(Ops) > 0 &&
+        internal::are_names_unique<typename PartitionBySpec::Names> &&
+        internal::are_names_in_columns<typename PartitionBySpec::Names, Columns...> &&
+        internal::are_names_unique<typename OrderBySpec::Names> &&
+        internal::are_names_in_columns<typename OrderBySpec::Names, Columns...> &&
+        internal::are_valid_window_ops<TypeList<Ops...>, Columns...>
+    )
+    auto window () const {
+        using DataFrameOps = typename internal::GetNewColumnsForWindowOps<TypeList<Ops...>, Columns...>::template To<DataFrame>;
+        using NewDataFrame = internal::DataFrameMerge<DataFrame, DataFrameOps>;
+        using Computation = internal::WindowComputation<PartitionBySpec, OrderBySpec, TypeList<Ops...>, Columns...>;
+
+        NewDataFrame result;
+        result.column_store_data_ = std::tuple_cat(column_store_data_, Computation::compute(column_store_data_, getSize()));
+        return result;
+    }
+
     // ############################################################################
     // API: Sort
     // ############################################################################
@@ -314,17 +513,46 @@ private:
     using ColumnStoreDataType = internal::ConstructColumnStoreDataType<std::vector, Columns...>;
     using IndicesForColumnStore = std::index_sequence_for<Columns...>;
 
+    /**
+     * Calls func with the summarization executer for the group-by and the strategy.
+    */
+    template <typename GroupBy, typename CompoundSummarizer, typename NewDataFrame, typename Func>
+    auto withSummarizationExecuter (const SummarizeOptions& summarize_options, Func&& func) const {
+        if constexpr (GroupBy::NumColumns == 0) {
+            return func.template operator()<internal::SummarizationExecuterNoGroupBy<NewDataFrame, CompoundSummarizer>>();
+        }
+        else {
+            using GroupByIndices = internal::GetColumnIndicesByNames<typename GroupBy::Names, Columns...>;
+            using GroupByTypes = typename internal::GetColumnTypesByNames<typename GroupBy::Names, Columns...>::template To<std::tuple>;
+            using KeyDomain = internal::GetKeyDomain<GroupBy, GroupByTypes>;
+            if constexpr (not std::is_same_v<KeyDomain, internal::NoKeyDomain>) {
+                return func.template operator()<internal::SummarizationExecuterGroupBy<NewDataFrame, GroupByIndices, GroupByTypes, CompoundSummarizer, SummarizeStrategy::Hash, KeyDomain>>();
+            }
+            else {
+                if (summarize_options.strategy == SummarizeStrategy::SortedRuns) {
+                    return func.template operator()<internal::SummarizationExecuterGroupBy<NewDataFrame, GroupByIndices, GroupByTypes, CompoundSummarizer, SummarizeStrategy::SortedRuns>>();
+                }
+                return func.template operator()<internal::SummarizationExecuterGroupBy<NewDataFrame, GroupByIndices, GroupByTypes, CompoundSummarizer>>();
+            }
+        }
+    }
+
     template <std::size_t ...Indices>
     void assureSufficientCapacityInColumnStore (std::size_t amount_to_insert, std::integer_sequence<std::size_t, Indices...>) {
         if constexpr (sizeof...(Columns) > 0) {
             const auto& first_column_data = std::get<0>(column_store_data_);
             if (first_column_data.size() + amount_to_insert >= first_column_data.capacity()) {
-                const std::size_t new_capacity = first_column_data.capacity() * 1.50;
+                const std::size_t new_capacity = std::max(first_column_data.size() + amount_to_insert, static_cast<std::size_t>(first_column_data.capacity() * 1.50));
                 ((std::get<Indices>(column_store_data_).reserve(new_capacity)), ...);
             }
         }
     }
 
+    template <std::size_t ...Indices>
+    void resizeColumnStore (std::size_t size, std::integer_sequence<std::size_t, Indices...>) {
+        ((std::get<Indices>(column_store_data_).resize(size)), ...);
+    }
+
     template <typename ...TypesToInsert, std::size_t ...Indices>
     void insertImpl (TypesToInsert&& ...values, std::integer_sequence<std::size_t, Indices...>) {
         (std::get<Indices>(column_store_data_).push_back(std::forward<TypesToInsert>(values)), ...);
@@ -370,31 +598,81 @@ private:
         return result;
     }
 
-    template <Join JoinType, typename NewDataFrame, typename JoinIndicesSelf, typename JoinIndicesOther, typename DataIndicesInResultOther, typename DataIndicesToCopyOther, typename DataFrameOther>
-    auto joinImpl(const DataFrameOther& df) {
-        NewDataFrame result{};
-        if constexpr (JoinType == Join::Inner) {
-            for (auto i = 0LU; i < getSize(); ++i) {
-                for (auto j = 0LU; j < df.getSize(); ++j) {
-                    if (compareJoinIndices(df, i, j, JoinIndicesSelf{}, JoinIndicesOther{})) {
-                        addJoinedColumnData(result.column_store_data_, df, i, j, IndicesForColumnStore{}, DataIndicesInResultOther{}, DataIndicesToCopyOther{});
-                    }
+    template <Join JoinType, typename JoinTypes, typename JoinIndicesSelf, typename JoinIndicesOther, typename DataFrameOther>
+    internal::JoinMatches computeJoinMatches (const DataFrameOther& df, const JoinOptions& join_options) const {
+        if constexpr (JoinType == Join::AsOf) {
+            return internal::asOfJoin(
+                internal::tieColumns(column_store_data_, JoinIndicesSelf{}),
+                getSize(),
+                internal::tieColumns(df.column_store_data_, JoinIndicesOther{}),
+                df.getSize()
+            );
+        }
+        else {
+            if constexpr (internal::are_types_less_than_comparable<JoinTypes>) {
+                if (join_options.strategy == JoinStrategy::SortMerge) {
+                    internal::JoinMatches matches {};
+                    internal::mergeJoin(
+                        internal::tieColumns(column_store_data_, JoinIndicesSelf{}),
+                        getSize(),
+                        internal::tieColumns(df.column_store_data_, JoinIndicesOther{}),
+                        df.getSize(),
+                        [&matches](std::size_t row_index_self, std::size_t row_index_other) {
+                            matches.add(row_index_self, row_index_other);
+                        }
+                    );
+                    return matches;
+                }
+            }
+            if constexpr (internal::are_types_hashable<JoinTypes>) {
+                if (join_options.strategy == JoinStrategy::PartitionedHash) {
+                    return internal::flattenJoinMatches(
+                        internal::partitionedHashJoin<JoinIndicesSelf, JoinIndicesOther>(column_store_data_, getSize(), df.column_store_data_, df.getSize(), join_options.num_threads),
+                        join_options.num_threads
+                    );
+                }
+                if (join_options.strategy != JoinStrategy::NestedLoop) {
+                    return internal::hashJoin<JoinIndicesSelf, JoinIndicesOther>(column_store_data_, getSize(), df.column_store_data_, df.getSize(), join_options.bloom_filter);
                 }
             }
+            return internal::nestedLoopJoin(column_store_data_, getSize(), JoinIndicesSelf{}, df.column_store_data_, df.getSize(), JoinIndicesOther{});
         }
-        return result;
     }
 
-    template <typename DataFrameOther, std::size_t ...JoinIndicesSelf, std::size_t ...JoinIndicesOther>
-    requires (sizeof...(JoinIndicesSelf) == sizeof...(JoinIndicesOther))
-    bool compareJoinIndices (const DataFrameOther& df, std::size_t row_index_self, std::size_t row_index_other, std::integer_sequence<std::size_t, JoinIndicesSelf...>, std::integer_sequence<std::size_t, JoinIndicesOther...>) {
-        return ((std::get<JoinIndicesSelf>(column_store_data_)[row_index_self] == std::get<JoinIndicesOther>(df.column_store_data_)[row_index_other]) && ...);
+    template <typename JoinTypes, typename JoinIndicesSelf, typename JoinIndicesOther, typename DataFrameOther>
+    std::vector<char> computeHasMatch (const DataFrameOther& df, const JoinOptions& join_options) const {
+        if constexpr (internal::are_types_hashable<JoinTypes>) {
+            if (join_options.strategy != JoinStrategy::NestedLoop) {
+                return internal::hashSemiJoin<JoinIndicesSelf, JoinIndicesOther>(column_store_data_, getSize(), df.column_store_data_, df.getSize(), join_options.bloom_filter);
+            }
+        }
+        return internal::nestedLoopSemiJoin(column_store_data_, getSize(), JoinIndicesSelf{}, df.column_store_data_, df.getSize(), JoinIndicesOther{});
     }
 
-    template <typename JoinedColumnStoreData, typename DataFrameOther, std::size_t ...ColumnIndicesSelf, std::size_t ...DataIndicesInResultOther, std::size_t ...DataIndicesToCopyOther>
-    void addJoinedColumnData (JoinedColumnStoreData& joined_data, const DataFrameOther& df, std::size_t row_index_self, std::size_t row_index_other, std::integer_sequence<std::size_t, ColumnIndicesSelf...>, std::integer_sequence<std::size_t, DataIndicesInResultOther...>, std::integer_sequence<std::size_t, DataIndicesToCopyOther...>) {
-        ((std::get<ColumnIndicesSelf>(joined_data).push_back(std::get<ColumnIndicesSelf>(column_store_data_)[row_index_self])), ...);
-        ((std::get<DataIndicesInResultOther>(joined_data).push_back(std::get<DataIndicesToCopyOther>(df.column_store_data_)[row_index_other])), ...);
+    template <Join JoinType>
+    DataFrame filterRowsByMatch (const std::vector<char>& has_match) const {
+        auto keep_row = [&has_match](std::size_t row_index) {
+            return static_cast<bool>(has_match[row_index]) == (JoinType == Join::Semi);
+        };
+        const auto num_rows_to_keep = std::ranges::count_if(std::views::iota(0LU, getSize()), keep_row);
+
+        std::vector<std::size_t> row_indices {};
+        row_indices.reserve(num_rows_to_keep);
+        for (auto row_index = 0LU; row_index < getSize(); ++row_index) {
+            if (keep_row(row_index)) {
+                row_indices.push_back(row_index);
+            }
+        }
+        return gatherRows(row_indices, IndicesForColumnStore{});
+    }
+
+    template <std::size_t ...Indices>
+    DataFrame gatherRows (const std::vector<std::size_t>& row_indices, std::integer_sequence<std::size_t, Indices...>) const {
+        DataFrame result{};
+        result.resizeColumnStore(row_indices.size(), IndicesForColumnStore{});
+        ((internal::gatherColumn<false>(std::get<Indices>(result.column_store_data_), std::get<Indices>(column_store_data_), row_indices, 0)), ...);
+        ((internal::gatherColumn<true>(std::get<Indices>(result.column_store_data_), std::get<Indices>(column_store_data_), row_indices, 0)), ...);
+        return result;
     }
 
     template <std::size_t ...Indices>
@@ -407,6 +685,226 @@ private:
     ColumnStoreDataType column_store_data_{};
 };
 
+// ############################################################################
+// Class: Joined Rows
+// ############################################################################
+/**
+ * Result of DataFrame::joinRows: the pairs of matching row indices of the left and right
+ * DataFrame. Both DataFrames are referenced, not copied, and must outlive this object.
+ *
+ * The function materialize<Names...>() copies the selected columns of the joined DataFrame
+ * (all columns if no names are given), such that columns not needed afterwards are never copied.
+*/
+template <typename DataFrameLhs, typename DataFrameRhs, typename ...JoinedColumns>
+class JoinedRows<DataFrameLhs, DataFrameRhs, DataFrame<JoinedColumns...>> {
+public:
+    JoinedRows (const DataFrameLhs& df_lhs, const DataFrameRhs& df_rhs, internal::JoinMatches matches, std::size_t num_threads)
+        : df_lhs_{df_lhs}, df_rhs_{df_rhs}, matches_{std::move(matches)}, num_threads_{num_threads} {}
+
+    std::size_t getSize () const {
+        return matches_.getSize();
+    }
+
+    const std::vector<std::size_t>& getLeftRowIndices () const {
+        return matches_.row_indices_lhs;
+    }
+
+    const std::vector<std::size_t>& getRightRowIndices () const {
+        return matches_.row_indices_rhs;
+    }
+
+    template <FixedString ...Names>
+    requires (
+        internal::are_names_unique<internal::NameList<Names...>> &&
+        internal::are_names_in_columns<internal::NameList<Names...>, JoinedColumns...>
+    )
+    auto materialize () const {
+        if constexpr (sizeof...(Names) == 0) {
+            return materializeImpl(internal::GetColumnNames<JoinedColumns...>{});
+        }
+        else {
+            return materializeImpl(internal::NameList<Names...>{});
+        }
+    }
+
+private:
+    static constexpr std::size_t ROWS_PER_GATHER_CHUNK = 16384;
+
+    template <FixedString ...Names>
+    auto materializeImpl (internal::NameList<Names...>) const {
+        using NewDataFrame = internal::GetDataFrameWithColumnsByName<internal::NameList<Names...>, JoinedColumns...>;
+        return gatherColumns<NewDataFrame, Names...>(std::make_index_sequence<sizeof...(Names)>{});
+    }
+
+    template <typename NewDataFrame, FixedString ...Names, std::size_t ...Indices>
+    NewDataFrame gatherColumns (std::integer_sequence<std::size_t, Indices...>) const {
+        NewDataFrame result{};
+        result.resizeColumnStore(getSize(), typename NewDataFrame::IndicesForColumnStore{});
+
+        const std::size_t num_chunks = (getSize() + ROWS_PER_GATHER_CHUNK - 1) / ROWS_PER_GATHER_CHUNK;
+        internal::parallelFor(num_chunks, num_threads_, [&](std::size_t chunk) {
+            ((gatherColumn<false, Names>(std::get<Indices>(result.column_store_data_), chunk)), ...);
+        });
+        for (auto chunk = 0LU; chunk < num_chunks; ++chunk) {
+            ((gatherColumn<true, Names>(std::get<Indices>(result.column_store_data_), chunk)), ...);
+        }
+        return result;
+    }
+
+    template <bool IsBoolColumnPass, FixedString Name, typename ColumnOut>
+    void gatherColumn (ColumnOut& column_out, std::size_t chunk) const {
+        const std::size_t offset = chunk * ROWS_PER_GATHER_CHUNK;
+        const std::size_t size = std::min(ROWS_PER_GATHER_CHUNK, getSize() - offset);
+        // the join columns are taken from the left DataFrame
+        if constexpr (requires { df_lhs_.get().template getColumn<Name>(); }) {
+            internal::gatherColumn<IsBoolColumnPass>(column_out, df_lhs_.get().template getColumn<Name>(), std::span{matches_.row_indices_lhs}.subspan(offset, size), offset);
+        }
+        else {
+            internal::gatherColumn<IsBoolColumnPass>(column_out, df_rhs_.get().template getColumn<Name>(), std::span{matches_.row_indices_rhs}.subspan(offset, size), offset);
+        }
+    }
+
+    std::reference_wrapper<const DataFrameLhs> df_lhs_;
+    std::reference_wrapper<const DataFrameRhs> df_rhs_;
+    internal::JoinMatches matches_;
+    std::size_t num_threads_;
+};
+
+// ############################################################################
+// Class: Join Index
+// ############################################################################
+/**
+ * Hash index on the join columns of a DataFrame that is reused by multiple joins, such that
+ * the hash table is built only once (see DataFrame::buildJoinIndex). The DataFrame is referenced,
+ * not copied, and must outlive the index.
+ *
+ * Rows may only be appended to the indexed DataFrame: appended rows are added to the index
+ * incrementally by update(), which is also called by every join using the index.
+*/
+template <typename IndexedDataFrame, FixedString ...JoinNames>
+class JoinIndex {};
+
+template <typename ...Columns, FixedString ...JoinNames>
+class JoinIndex<DataFrame<Columns...>, JoinNames...> {
+public:
+    using IndexedDataFrame = DataFrame<Columns...>;
+
+    explicit JoinIndex (const IndexedDataFrame& df) : df_{df}, hash_table_{df.column_store_data_, df.getSize()} {
+        update();
+    }
+
+    std::size_t getSize () const {
+        return hash_table_.getSize();
+    }
+
+    const IndexedDataFrame& getDataFrame () const {
+        return df_.get();
+    }
+
+    void update () {
+        const auto num_rows = df_.get().getSize();
+        if (num_rows < hash_table_.getSize()) {
+            throw JoinException("Indexed DataFrame has fewer rows than the join index");
+        }
+        for (auto row_index = hash_table_.getSize(); row_index < num_rows; ++row_index) {
+            hash_table_.insert(row_index);
+        }
+    }
+
+    template <typename ProbeData, typename ProbeIndices, typename Func>
+    void forEachMatch (const ProbeData& probe_data, std::size_t probe_row_index, ProbeIndices probe_indices, Func&& on_match) const {
+        const auto hash = internal::hashColumnStoreRow(probe_data, probe_row_index, probe_indices);
+        hash_table_.forEachMatch(probe_data, probe_row_index, hash, probe_indices, std::forward<Func>(on_match));
+    }
+
+    template <typename ProbeData, typename ProbeIndices>
+    bool containsMatch (const ProbeData& probe_data, std::size_t probe_row_index, ProbeIndices probe_indices) const {
+        const auto hash = internal::hashColumnStoreRow(probe_data, probe_row_index, probe_indices);
+        return hash_table_.containsMatch(probe_data, probe_row_index, hash, probe_indices);
+    }
+
+private:
+    using KeyIndices = internal::GetColumnIndicesByNames<internal::NameList<JoinNames...>, Columns...>;
+
+    std::reference_wrapper<const IndexedDataFrame> df_;
+    internal::JoinHashTable<typename IndexedDataFrame::ColumnStoreDataType, KeyIndices> hash_table_;
+};
+
+// ############################################################################
+// Class: Materialized Summary
+// ############################################################################
+/**
+ * Summary of a DataFrame that keeps the groups and summarizer states, such that rows appended
+ * to the DataFrame are summarized in time linear in the number of new rows instead of all rows
+ * (see DataFrame::materializeSummary). The DataFrame is referenced, not copied, and must outlive
+ * the summary.
+ *
+ * Rows may only be appended to the summarized DataFrame: appended rows are summarized by refresh().
+ * Only ops with constant state per group are supported (i.e. not the exact quantiles).
+*/
+template <typename SummarizedDataFrame, typename GroupBy, typename ...Ops>
+class MaterializedSummary {};
+
+template <typename ...Columns, typename GroupBy, typename ...Ops>
+class MaterializedSummary<DataFrame<Columns...>, GroupBy, Ops...> {
+public:
+    using SummarizedDataFrame = DataFrame<Columns...>;
+
+    MaterializedSummary (const SummarizedDataFrame& df, const SummarizeOptions& summarize_options) : df_{df}, num_threads_{summarize_options.num_threads} {
+        if (summarize_options.strategy != SummarizeStrategy::Hash) {
+            throw SummarizeException("MaterializedSummary supports the hash strategy only");
+        }
+        refresh();
+    }
+
+    /**
+     * Number of rows of the DataFrame summarized so far.
+    */
+    std::size_t getNumRows () const {
+        return num_rows_;
+    }
+
+    const SummarizedDataFrame& getDataFrame () const {
+        return df_.get();
+    }
+
+    void refresh () {
+        const auto num_rows = df_.get().getSize();
+        if (num_rows < num_rows_) {
+            throw SummarizeException("Summarized DataFrame has fewer rows than the summary");
+        }
+        internal::summarizeRows(executer_, df_.get().column_store_data_, num_rows_, num_rows, num_threads_);
+        num_rows_ = num_rows;
+    }
+
+    /**
+     * Returns the summary of the rows summarized so far, as returned by DataFrame::summarize.
+    */
+    auto getResult () const {
+        return executer_.constructResult();
+    }
+
+private:
+    using GroupByIndices = internal::GetColumnIndicesByNames<typename GroupBy::Names, Columns...>;
+    using GroupByTypes = typename internal::GetColumnTypesByNames<typename GroupBy::Names, Columns...>::template To<std::tuple>;
+
+    using CompoundSummarizer = internal::GetCompoundSummarizer<TypeList<Ops...>, Columns...>;
+    using DataFrameGroupBy = internal::GetDataFrameWithColumnsByName<typename GroupBy::Names, Columns...>;
+    using DataFrameOps = typename internal::GetNewColumnsForOps<TypeList<Ops...>, Columns...>::template To<DataFrame>;
+    using KeyDomain = internal::GetKeyDomain<GroupBy, GroupByTypes>;
+
+    using Executer = std::conditional_t<
+        GroupBy::NumColumns == 0,
+        internal::SummarizationExecuterNoGroupBy<DataFrameOps, CompoundSummarizer>,
+        internal::SummarizationExecuterGroupBy<internal::DataFrameMerge<DataFrameGroupBy, DataFrameOps>, GroupByIndices, GroupByTypes, CompoundSummarizer, SummarizeStrategy::Hash, KeyDomain>
+    >;
+
+    std::reference_wrapper<const SummarizedDataFrame> df_;
+    std::size_t num_threads_;
+    std::size_t num_rows_ {0};
+    Executer executer_{};
+};
+
 #define dacr_param auto data
 #define dacr_value(field_name) data.template get<field_name>()
 
@@ -0,0 +1,81 @@
+// Copyright 2022 Andi Hellmund
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+#ifndef DATA_CRUNCHING_INTERNAL_ARENA_HPP
+#define DATA_CRUNCHING_INTERNAL_ARENA_HPP
+
+#include <algorithm>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace dacr::internal {
+
+// ############################################################################
+// Class: Value Arena
+// ############################################################################
+/**
+ * Monotonic arena handing out contiguous arrays of trivial values from large blocks.
+ *
+ * Arrays are never freed individually, but all at once with the arena. Blocks grow
+ * geometrically, such that the number of heap allocations is logarithmic in the number
+ * of values, independent of the number of arrays.
+*/
+template <typename T>
+requires (std::is_trivially_copyable_v<T>)
+class ValueArena {
+public:
+    T* allocate (std::size_t size) {
+        if (size > remaining_size_) {
+            const auto block_size = std::max({MIN_BLOCK_SIZE, size, allocated_size_});
+            blocks_.push_back(std::make_unique_for_overwrite<T[]>(block_size));
+            next_ = blocks_.back().get();
+            remaining_size_ = block_size;
+            allocated_size_ += block_size;
+        }
+        T* values = next_;
+        next_ += size;
+        remaining_size_ -= size;
+        return values;
+    }
+
+    /**
+     * Grows the most recently allocated array in place if the current block has room for it.
+     * Returns false otherwise, in which case the array is unchanged.
+    */
+    bool extend (T* values, std::size_t size, std::size_t new_size) {
+        if (values + size != next_ || new_size - size > remaining_size_) {
+            return false;
+        }
+        next_ += new_size - size;
+        remaining_size_ -= new_size - size;
+        return true;
+    }
+
+    std::size_t getNumBlocks () const {
+        return blocks_.size();
+    }
+
+private:
+    static constexpr std::size_t MIN_BLOCK_SIZE = 4096;
+
+    std::vector<std::unique_ptr<T[]>> blocks_{};
+    T* next_ {nullptr};
+    std::size_t remaining_size_ {0};
+    std::size_t allocated_size_ {0};
+};
+
+} // namespace dacr::internal
+
+#endif // DATA_CRUNCHING_INTERNAL_ARENA_HPP
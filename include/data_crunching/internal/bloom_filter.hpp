@@ -0,0 +1,92 @@
+// Copyright 2022 Andi Hellmund
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+#ifndef DATA_CRUNCHING_INTERNAL_BLOOM_FILTER_HPP
+#define DATA_CRUNCHING_INTERNAL_BLOOM_FILTER_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <vector>
+
+namespace dacr::internal {
+
+// ############################################################################
+// Class: Blocked Bloom Filter
+// ############################################################################
+/**
+ * Bloom filter operating on (already mixed) 64-bit hashes.
+ *
+ * All bits of a key are located in a single block of one cache line: the high bits of
+ * the hash select the block, the low 32 bits set one bit in each of the eight words of
+ * the block (split block Bloom filter). A lookup therefore touches a single cache line.
+*/
+class BlockedBloomFilter {
+public:
+    explicit BlockedBloomFilter (std::size_t expected_num_keys) {
+        const std::size_t num_blocks = std::bit_ceil(std::max<std::size_t>(1, (expected_num_keys * BITS_PER_KEY + BITS_PER_BLOCK - 1) / BITS_PER_BLOCK));
+        blocks_.resize(num_blocks);
+        block_bits_ = std::bit_width(num_blocks) - 1;
+    }
+
+    std::size_t getNumBlocks () const {
+        return blocks_.size();
+    }
+
+    void insert (std::uint64_t hash) {
+        auto& block = blocks_[getBlockIndex(hash)];
+        for (auto word_index = 0LU; word_index < WORDS_PER_BLOCK; ++word_index) {
+            block.words[word_index] |= getBitMask(hash, word_index);
+        }
+    }
+
+    bool mayContain (std::uint64_t hash) const {
+        const auto& block = blocks_[getBlockIndex(hash)];
+        std::uint64_t missing_bits {0};
+        for (auto word_index = 0LU; word_index < WORDS_PER_BLOCK; ++word_index) {
+            const auto bit_mask = getBitMask(hash, word_index);
+            missing_bits |= (block.words[word_index] & bit_mask) ^ bit_mask;
+        }
+        return missing_bits == 0;
+    }
+
+private:
+    static constexpr std::size_t WORDS_PER_BLOCK = 8;
+    static constexpr std::size_t BITS_PER_BLOCK = WORDS_PER_BLOCK * 64;
+    static constexpr std::size_t BITS_PER_KEY = 16;
+    static constexpr std::array<std::uint32_t, WORDS_PER_BLOCK> SALTS = {
+        0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU, 0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U
+    };
+
+    struct alignas(64) Block {
+        std::array<std::uint64_t, WORDS_PER_BLOCK> words {};
+    };
+
+    std::size_t getBlockIndex (std::uint64_t hash) const {
+        return block_bits_ == 0 ? 0 : hash >> (64 - block_bits_);
+    }
+
+    static std::uint64_t getBitMask (std::uint64_t hash, std::size_t word_index) {
+        const std::uint32_t bit_index = (static_cast<std::uint32_t>(hash) * SALTS[word_index]) >> 26;
+        return std::uint64_t{1} << bit_index;
+    }
+
+    std::vector<Block> blocks_ {};
+    std::size_t block_bits_ {0};
+};
+
+} // namespace dacr::internal
+
+#endif // DATA_CRUNCHING_INTERNAL_BLOOM_FILTER_HPP
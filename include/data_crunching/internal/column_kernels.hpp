@@ -0,0 +1,114 @@
+// Copyright 2022 Andi Hellmund
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+#ifndef DATA_CRUNCHING_INTERNAL_COLUMN_KERNELS_HPP
+#define DATA_CRUNCHING_INTERNAL_COLUMN_KERNELS_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <span>
+
+namespace dacr::internal {
+
+// ############################################################################
+// Function: Reduce Column
+// ############################################################################
+/**
+ * Reduces a contiguous range of column values by a combining function.
+ *
+ * The values are accumulated into independent accumulators, one per lane, which breaks the
+ * dependency chain of a single accumulator: the loop is pipelined and, since the order of
+ * the combinations is fixed by the lanes, auto-vectorized by the compiler even for
+ * floating-point values (e.g. to AVX2 with -mavx2). The lanes are combined at the end.
+*/
+template <typename Accumulator, typename T, typename Combine>
+Accumulator reduceColumn (const T* values, std::size_t size, Accumulator init, Combine&& combine) {
+    static constexpr std::size_t NUM_LANES = 16;
+
+    std::array<Accumulator, NUM_LANES> lanes{};
+    lanes.fill(init);
+    std::size_t index {0};
+    for (; index + NUM_LANES <= size; index += NUM_LANES) {
+        for (auto lane = 0LU; lane < NUM_LANES; ++lane) {
+            lanes[lane] = combine(lanes[lane], values[index + lane]);
+        }
+    }
+    for (; index < size; ++index) {
+        lanes[0] = combine(lanes[0], values[index]);
+    }
+
+    Accumulator result {init};
+    for (auto lane = 0LU; lane < NUM_LANES; ++lane) {
+        result = combine(result, lanes[lane]);
+    }
+    return result;
+}
+
+template <typename Accumulator, typename T>
+Accumulator reduceSum (const T* values, std::size_t size) {
+    return reduceColumn<Accumulator>(values, size, Accumulator{0}, [](Accumulator sum, auto value) {
+        return static_cast<Accumulator>(sum + static_cast<Accumulator>(value));
+    });
+}
+
+/**
+ * Returns the minimum of the values and init. NaN values are ignored, as by operator<.
+*/
+template <typename T>
+T reduceMin (const T* values, std::size_t size, T init) {
+    return reduceColumn<T>(values, size, init, [](T min_value, T value) {
+        return value < min_value ? value : min_value;
+    });
+}
+
+/**
+ * Returns the maximum of the values and init. NaN values are ignored, as by operator>.
+*/
+template <typename T>
+T reduceMax (const T* values, std::size_t size, T init) {
+    return reduceColumn<T>(values, size, init, [](T max_value, T value) {
+        return value > max_value ? value : max_value;
+    });
+}
+
+// ############################################################################
+// Function: Select Ranks
+// ############################################################################
+template <std::random_access_iterator Iterator>
+void selectRanksImpl (Iterator first, Iterator begin, Iterator end, std::span<const std::size_t> ranks) {
+    if (ranks.empty() || begin == end) {
+        return;
+    }
+    const auto middle = ranks.size() / 2;
+    const auto nth = first + ranks[middle];
+    std::nth_element(begin, nth, end);
+    selectRanksImpl(first, begin, nth, ranks.first(middle));
+    selectRanksImpl(first, nth + 1, end, ranks.subspan(middle + 1));
+}
+
+/**
+ * Reorders [begin, end) such that the elements at the (ascending, distinct) ranks are those of
+ * the sorted range. The middle rank is selected first, which partitions the range for the ranks
+ * left and right of it, such that k ranks are selected in O(n log k) instead of sorting.
+*/
+template <std::random_access_iterator Iterator>
+void selectRanks (Iterator begin, Iterator end, std::span<const std::size_t> ranks) {
+    selectRanksImpl(begin, begin, end, ranks);
+}
+
+} // namespace dacr::internal
+
+#endif // DATA_CRUNCHING_INTERNAL_COLUMN_KERNELS_HPP
@@ -35,6 +35,9 @@ class DataFrame;
 
 enum class Join : int {
     Inner = 0,
+    Semi,
+    Anti,
+    AsOf,
 };
 
 namespace internal {
@@ -0,0 +1,357 @@
+// Copyright 2022 Andi Hellmund
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+#ifndef DATA_CRUNCHING_INTERNAL_DATAFRAME_GROUPING_SETS_HPP
+#define DATA_CRUNCHING_INTERNAL_DATAFRAME_GROUPING_SETS_HPP
+
+#include <array>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "data_crunching/internal/dataframe_summarize.hpp"
+#include "data_crunching/internal/fixed_string.hpp"
+#include "data_crunching/internal/name_list.hpp"
+#include "data_crunching/internal/type_list.hpp"
+#include "data_crunching/internal/utils.hpp"
+#include "data_crunching/internal/column.hpp"
+
+namespace dacr {
+
+namespace internal {
+
+template <typename>
+struct IsGroupByImpl : std::false_type {};
+
+template <FixedString ...GroupByNames>
+struct IsGroupByImpl<GroupBy<GroupByNames...>> : std::true_type {};
+
+// ############################################################################
+// Trait: Get Rollup Sets
+// ############################################################################
+template <FixedString, typename>
+struct GroupByPrependImpl {};
+
+template <FixedString NameToPrepend, FixedString ...GroupByNames>
+struct GroupByPrependImpl<NameToPrepend, GroupBy<GroupByNames...>> {
+    using type = GroupBy<NameToPrepend, GroupByNames...>;
+};
+
+/**
+ * Prefixes of the names from all names to the empty one, e.g. (a, b), (a) and () for (a, b): the
+ * prefixes of (a, b) are (a) prepended to the prefixes of (b), followed by the empty one.
+*/
+template <FixedString ...Names>
+struct GetRollupSetsImpl {
+    using type = TypeList<GroupBy<>>;
+};
+
+template <FixedString NameToPrepend, typename>
+struct PrependToRollupSetsImpl {};
+
+template <FixedString NameToPrepend, typename ...GroupBys>
+struct PrependToRollupSetsImpl<NameToPrepend, TypeList<GroupBys...>> {
+    using type = TypeList<typename GroupByPrependImpl<NameToPrepend, GroupBys>::type..., GroupBy<>>;
+};
+
+template <FixedString FirstName, FixedString ...RestNames>
+struct GetRollupSetsImpl<FirstName, RestNames...> {
+    using type = typename PrependToRollupSetsImpl<FirstName, typename GetRollupSetsImpl<RestNames...>::type>::type;
+};
+
+} // namespace internal
+
+/**
+ * Summarizes the rows by each of the group-by specs GroupBys in a single scan, e.g. by
+ * GroupBy<"region", "city">, GroupBy<"region"> and GroupBy<> for the grand total.
+*/
+template <typename ...GroupBys>
+requires (sizeof...(GroupBys) > 0 && (internal::IsGroupByImpl<GroupBys>::value && ...))
+struct GroupingSets {
+    using Sets = TypeList<GroupBys...>;
+};
+
+/**
+ * Grouping sets of all prefixes of the names, from all names to the grand total.
+*/
+template <FixedString ...Names>
+struct Rollup {
+    using Sets = typename internal::GetRollupSetsImpl<Names...>::type;
+};
+
+namespace internal {
+
+// ############################################################################
+// Concept: Is Grouping Sets Spec
+// ############################################################################
+template <typename>
+struct IsGroupingSetsSpecImpl : std::false_type {};
+
+template <typename ...GroupBys>
+struct IsGroupingSetsSpecImpl<GroupingSets<GroupBys...>> : std::true_type {};
+
+template <FixedString ...Names>
+struct IsGroupingSetsSpecImpl<Rollup<Names...>> : std::true_type {};
+
+template <typename T>
+concept IsGroupingSetsSpec = IsGroupingSetsSpecImpl<T>::value;
+
+// ############################################################################
+// Trait: Get Grouping Sets Names
+// ############################################################################
+template <typename, typename>
+struct GetGroupingSetsNamesImpl {};
+
+template <typename UnionNames>
+struct GetGroupingSetsNamesImpl<UnionNames, TypeList<>> {
+    using type = UnionNames;
+};
+
+template <typename UnionNames, typename FirstSet, typename ...RestSets>
+struct GetGroupingSetsNamesImpl<UnionNames, TypeList<FirstSet, RestSets...>> {
+    using type = typename GetGroupingSetsNamesImpl<
+        NameListMerge<UnionNames, NameListDifference<typename FirstSet::Names, UnionNames>>,
+        TypeList<RestSets...>
+    >::type;
+};
+
+/**
+ * Union of the group-by names of all sets in the order of their first appearance.
+*/
+template <typename GroupingSetsSpec>
+using GetGroupingSetsNames = typename GetGroupingSetsNamesImpl<NameList<>, typename GroupingSetsSpec::Sets>::type;
+
+// ############################################################################
+// Trait: Get Grouping Set Key Indices
+// ############################################################################
+template <FixedString Name, FixedString ...KeyNames>
+constexpr std::size_t getKeyIndexByName () {
+    std::size_t index {0};
+    bool is_found {false};
+    ((is_found = is_found || areFixedStringsEqual(Name, KeyNames), index += is_found ? 0 : 1), ...);
+    return index;
+}
+
+template <typename, typename>
+struct GetKeyIndicesOfSetImpl {};
+
+template <FixedString ...SetNames, FixedString ...KeyNames>
+struct GetKeyIndicesOfSetImpl<NameList<SetNames...>, NameList<KeyNames...>> {
+    using type = std::integer_sequence<std::size_t, getKeyIndexByName<SetNames, KeyNames...>()...>;
+};
+
+template <typename>
+struct GetGroupingSetKeyIndicesImpl {};
+
+template <typename ...Sets>
+struct GetGroupingSetKeyIndicesImpl<TypeList<Sets...>> {
+    using type = TypeList<typename GetKeyIndicesOfSetImpl<typename Sets::Names, typename GetGroupingSetsNamesImpl<NameList<>, TypeList<Sets...>>::type>::type...>;
+};
+
+/**
+ * Indices of the group-by columns of each set within the key columns, i.e. the union of all sets.
+*/
+template <typename GroupingSetsSpec>
+using GetGroupingSetKeyIndices = typename GetGroupingSetKeyIndicesImpl<typename GroupingSetsSpec::Sets>::type;
+
+// ############################################################################
+// Class: Grouping Sets Executer
+// ############################################################################
+/**
+ * Summarizes the rows by the key columns, i.e. the finest groups, in a single scan. The groups of
+ * each set are derived by merging the summarizer states of the finest groups, such that the cost of
+ * a set is linear in the number of finest groups instead of the number of rows.
+ *
+ * The result contains the groups of the sets in the order of the sets. Key columns not part of a
+ * set are default-constructed and the column grouping_set holds the index of the set.
+*/
+template <typename NewDataFrame, typename KeyColumnIndices, typename KeyTypes, typename SetKeyIndices, typename CompoundSummarizer>
+class GroupingSetsExecuter {};
+
+template <typename NewDataFrame, typename KeyColumnIndices, typename ...KeyTypes, typename ...SetKeyIndices, typename CompoundSummarizer>
+class GroupingSetsExecuter<NewDataFrame, KeyColumnIndices, std::tuple<KeyTypes...>, TypeList<SetKeyIndices...>, CompoundSummarizer> {
+public:
+    template <typename ColumnStoreData>
+    static NewDataFrame execute (const ColumnStoreData& column_store_data, std::size_t num_rows, const SummarizeOptions& summarize_options) {
+        if (summarize_options.strategy == SummarizeStrategy::SortedRuns) {
+            return executeWith<SummarizeStrategy::SortedRuns>(column_store_data, num_rows, summarize_options.num_threads);
+        }
+        return executeWith<SummarizeStrategy::Hash>(column_store_data, num_rows, summarize_options.num_threads);
+    }
+
+private:
+    using KeyData = std::tuple<std::vector<KeyTypes>...>;
+    using KeyIndices = std::index_sequence_for<KeyTypes...>;
+    using ResultIndices = std::make_index_sequence<CompoundSummarizer::NumResults>;
+
+    /**
+     * Index of the last set of all key columns (or the number of sets if none), which moves the keys
+     * of the finest groups into the result, whereas sets of all key columns before copy them.
+    */
+    static constexpr std::size_t getLastFinestSetIndex () {
+        constexpr std::array<bool, sizeof...(SetKeyIndices)> is_finest_set{std::is_same_v<SetKeyIndices, KeyIndices>...};
+        std::size_t last_finest_set_index {sizeof...(SetKeyIndices)};
+        for (auto set_index = 0LU; set_index < is_finest_set.size(); ++set_index) {
+            if (is_finest_set[set_index]) {
+                last_finest_set_index = set_index;
+            }
+        }
+        return last_finest_set_index;
+    }
+
+    template <SummarizeStrategy Strategy, typename ColumnStoreData>
+    static NewDataFrame executeWith (const ColumnStoreData& column_store_data, std::size_t num_rows, std::size_t num_threads) {
+        SummarizationExecuterGroupBy<void, KeyColumnIndices, std::tuple<KeyTypes...>, CompoundSummarizer, Strategy> finest_executer{};
+        summarizeRows(finest_executer, column_store_data, 0, num_rows, num_threads);
+
+        // the keys of the finest groups as column store, such that the groups of a set are found as for rows
+        KeyData key_data{};
+        for (const auto& key : finest_executer.getGroupByData()) {
+            appendKey(key_data, key, KeyIndices{});
+        }
+
+        // the groups of all sets are found first, such that the capacity of the result is reserved once
+        auto set_executers = std::make_tuple(createSetExecuter<SetKeyIndices>(finest_executer, key_data)...);
+        return std::apply([&](auto& ...executers) {
+            const std::size_t num_groups = (getNumGroups(executers, finest_executer) + ...);
+            NewDataFrame result{};
+            std::apply([&](auto& ...columns) {
+                (columns.reserve(num_groups), ...);
+            }, result.column_store_data_);
+
+            std::size_t set_index {0};
+            (appendSet<SetKeyIndices>(result, set_index++, executers, finest_executer, key_data), ...);
+            return result;
+        }, set_executers);
+    }
+
+    template <std::size_t ...Indices>
+    static void appendKey (KeyData& key_data, const std::tuple<KeyTypes...>& key, std::integer_sequence<std::size_t, Indices...>) {
+        (std::get<Indices>(key_data).push_back(std::get<Indices>(key)), ...);
+    }
+
+    /**
+     * Finds the groups of a set by merging the finest groups. The groups of a set of all key columns
+     * are the finest groups, which is marked by std::monostate.
+    */
+    template <typename SetKeyIndicesOfSet, typename FinestExecuter>
+    static auto createSetExecuter (const FinestExecuter& finest_executer, const KeyData& key_data) {
+        if constexpr (std::is_same_v<SetKeyIndicesOfSet, KeyIndices>) {
+            return std::monostate{};
+        }
+        else {
+            using SetTypes = typename GetSetTypesImpl<SetKeyIndicesOfSet>::type;
+            SummarizationExecuterGroupBy<void, SetKeyIndicesOfSet, SetTypes, CompoundSummarizer> executer{};
+            if constexpr (get_integer_sequence_size<SetKeyIndicesOfSet> == 0) {
+                // the grand total has a group even without rows, as the summarization without group-by
+                executer.getOrCreateGroupIndex(key_data, 0);
+            }
+            const auto& finest_summarizer_data = finest_executer.getSummarizerData();
+            for (auto group_index = 0LU; group_index < finest_summarizer_data.size(); ++group_index) {
+                executer.mergeIntoGroup(key_data, group_index, finest_summarizer_data[group_index]);
+            }
+            return executer;
+        }
+    }
+
+    template <typename SetExecuter, typename FinestExecuter>
+    static std::size_t getNumGroups (const SetExecuter& set_executer, const FinestExecuter& finest_executer) {
+        if constexpr (std::is_same_v<SetExecuter, std::monostate>) {
+            return finest_executer.getNumGroups();
+        }
+        else {
+            return set_executer.getNumGroups();
+        }
+    }
+
+    template <typename SetKeyIndicesOfSet, typename SetExecuter, typename FinestExecuter>
+    static void appendSet (NewDataFrame& result, std::size_t set_index, SetExecuter& set_executer, const FinestExecuter& finest_executer, KeyData& key_data) {
+        if constexpr (std::is_same_v<SetExecuter, std::monostate>) {
+            // the key data is not needed after the last set of all key columns, such that its keys are moved into the result
+            const bool is_last_finest_set = set_index == getLastFinestSetIndex();
+            appendGroups(result, set_index, finest_executer.getSummarizerData(), [&]<std::size_t Index>(std::size_t group_index) {
+                auto&& key = std::get<Index>(key_data)[group_index];
+                if (is_last_finest_set) {
+                    return std::move(key);
+                }
+                return key;
+            }, KeyIndices{}, ResultIndices{});
+        }
+        else {
+            auto& group_by_data = set_executer.getGroupByData();
+            appendGroups(result, set_index, set_executer.getSummarizerData(), [&]<std::size_t Index>(std::size_t group_index) {
+                return getKeyValue<Index>(group_by_data[group_index], SetKeyIndicesOfSet{});
+            }, KeyIndices{}, ResultIndices{});
+        }
+    }
+
+    /**
+     * Appends the groups of a set to the result column by column.
+    */
+    template <typename SummarizerData, typename GetKey, std::size_t ...Indices, std::size_t ...ResultIndicesInData>
+    static void appendGroups (NewDataFrame& result, std::size_t set_index, const SummarizerData& summarizer_data, GetKey&& get_key, std::integer_sequence<std::size_t, Indices...>, std::integer_sequence<std::size_t, ResultIndicesInData...>) {
+        const std::size_t num_groups = summarizer_data.size();
+        (appendToColumn(std::get<Indices>(result.column_store_data_), num_groups, [&](std::size_t group_index) {
+            return get_key.template operator()<Indices>(group_index);
+        }), ...);
+        appendToColumn(std::get<sizeof...(KeyTypes)>(result.column_store_data_), num_groups, [&](std::size_t) {
+            return set_index;
+        });
+        (appendToColumn(std::get<sizeof...(KeyTypes) + 1 + ResultIndicesInData>(result.column_store_data_), num_groups, [&](std::size_t group_index) {
+            return CompoundSummarizer::template getResult<ResultIndicesInData>(summarizer_data[group_index]);
+        }), ...);
+    }
+
+    /**
+     * Value of the key column at Index for a group of a set, default-constructed if the column is not part of the set.
+    */
+    template <std::size_t Index, typename SetKey, std::size_t ...SetIndices>
+    static auto getKeyValue (const SetKey& set_key, std::integer_sequence<std::size_t, SetIndices...>) {
+        using KeyType = std::tuple_element_t<Index, std::tuple<KeyTypes...>>;
+        constexpr std::array<std::size_t, sizeof...(SetIndices)> set_indices{SetIndices...};
+        constexpr std::size_t position = getPositionInSet<Index>(set_indices);
+        if constexpr (position < sizeof...(SetIndices)) {
+            return KeyType{std::get<position>(set_key)};
+        }
+        else {
+            return KeyType{};
+        }
+    }
+
+    template <std::size_t Index, std::size_t N>
+    static constexpr std::size_t getPositionInSet (const std::array<std::size_t, N>& set_indices) {
+        for (auto position = 0LU; position < N; ++position) {
+            if (set_indices[position] == Index) {
+                return position;
+            }
+        }
+        return N;
+    }
+
+    template <typename>
+    struct GetSetTypesImpl {};
+
+    template <std::size_t ...Indices>
+    struct GetSetTypesImpl<std::integer_sequence<std::size_t, Indices...>> {
+        using type = std::tuple<std::tuple_element_t<Indices, std::tuple<KeyTypes...>>...>;
+    };
+};
+
+} // namespace internal
+
+} // namespace dacr
+
+#endif // DATA_CRUNCHING_INTERNAL_DATAFRAME_GROUPING_SETS_HPP
@@ -0,0 +1,708 @@
+// Copyright 2022 Andi Hellmund
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+#ifndef DATA_CRUNCHING_INTERNAL_DATAFRAME_JOIN_HPP
+#define DATA_CRUNCHING_INTERNAL_DATAFRAME_JOIN_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "data_crunching/internal/bloom_filter.hpp"
+#include "data_crunching/internal/column.hpp"
+#include "data_crunching/internal/dataframe_general.hpp"
+#include "data_crunching/internal/dataframe_sort.hpp"
+#include "data_crunching/internal/hash.hpp"
+#include "data_crunching/internal/name_list.hpp"
+#include "data_crunching/internal/parallel.hpp"
+
+namespace dacr {
+
+enum class JoinStrategy {
+    /* build a hash table on the smaller DataFrame and probe it with the other one */
+    Hash = 0,
+    /* compare every row of one DataFrame with every row of the other one */
+    NestedLoop,
+    /* merge both DataFrames in a single pass. Both must be sorted ascending by the join columns */
+    SortMerge,
+    /* partition both DataFrames by the hash of the join columns and join the partitions in parallel */
+    PartitionedHash,
+};
+
+enum class JoinBloomFilter {
+    /* use a Bloom filter if the DataFrame the hash table is built on is much smaller than the probing one */
+    Auto = 0,
+    Enabled,
+    Disabled,
+};
+
+class JoinException : public std::runtime_error {
+public:
+    using std::runtime_error::runtime_error;
+};
+
+struct JoinOptions {
+    /* algorithm used to find matching rows. Hash falls back to NestedLoop for non-hashable join columns,
+       SortMerge falls back to Hash for join columns without operator< */
+    JoinStrategy strategy {JoinStrategy::Hash};
+    /* number of threads for PartitionedHash. Default: all hardware threads */
+    std::size_t num_threads {0};
+    /* prefilter the probing rows by a Bloom filter over the join columns of the build side (Hash only) */
+    JoinBloomFilter bloom_filter {JoinBloomFilter::Auto};
+};
+
+namespace internal {
+
+// ############################################################################
+// Trait: Is Filtering Join
+// ############################################################################
+/**
+ * Filtering joins keep (or drop) the rows of the left DataFrame depending on the existence
+ * of a match in the right DataFrame. The result has the columns of the left DataFrame only.
+*/
+template <Join JoinType>
+constexpr bool is_filtering_join = (JoinType == Join::Semi || JoinType == Join::Anti);
+
+// ############################################################################
+// Trait: Is Valid Join
+// ############################################################################
+template <Join JoinType, typename JoinNames, typename ColumnsLhs, typename ColumnsRhs>
+struct IsValidJoinImpl : std::false_type {};
+
+template <Join JoinType, FixedString ...JoinNames, typename ...ColumnsLhs, typename ...ColumnsRhs>
+struct IsValidJoinImpl<JoinType, NameList<JoinNames...>, TypeList<ColumnsLhs...>, TypeList<ColumnsRhs...>> {
+    static constexpr bool value = (
+        sizeof...(JoinNames) > 0 &&
+        are_names_unique<NameList<JoinNames...>> &&
+        are_names_in_columns<NameList<JoinNames...>, ColumnsLhs...> &&
+        are_names_in_columns<NameList<JoinNames...>, ColumnsRhs...> &&
+        (is_filtering_join<JoinType> || are_names_unique<
+            NameListMerge<
+                NameListDifference<GetColumnNames<ColumnsLhs...>, NameList<JoinNames...>>,
+                NameListDifference<GetColumnNames<ColumnsRhs...>, NameList<JoinNames...>>
+            >
+        >) &&
+        are_columns_the_same_in_two_lists_by_names<NameList<JoinNames...>, TypeList<ColumnsLhs...>, TypeList<ColumnsRhs...>> &&
+        (JoinType != Join::AsOf || are_types_less_than_comparable<GetColumnTypesByNames<NameList<JoinNames...>, ColumnsLhs...>>)
+    );
+};
+
+template <Join JoinType, typename JoinNames, typename ColumnsLhs, typename ColumnsRhs>
+constexpr bool is_valid_join = IsValidJoinImpl<JoinType, JoinNames, ColumnsLhs, ColumnsRhs>::value;
+
+// ############################################################################
+// Trait: Get Joined DataFrame
+// ############################################################################
+/**
+ * The joined DataFrame consists of all columns of the left DataFrame followed by the
+ * non-join columns of the right DataFrame.
+*/
+template <typename JoinNames, typename DataFrameLhs, typename ...ColumnsRhs>
+using GetJoinedDataFrame = DataFrameMerge<
+    DataFrameLhs,
+    GetDataFrameWithColumnsByName<NameListDifference<GetColumnNames<ColumnsRhs...>, JoinNames>, ColumnsRhs...>
+>;
+
+// ############################################################################
+// Class: Join Hash Table
+// ############################################################################
+/**
+ * Hash table over the join columns of a column store.
+ *
+ * The table stores row indices only: keys are compared against the column store
+ * on lookup, so no key data (e.g. strings) is copied. Rows with equal bucket are
+ * chained in insertion order, such that matches are reported in ascending row order
+ * if rows are inserted in ascending order.
+*/
+template <typename ColumnStoreData, typename KeyIndices>
+class JoinHashTable {};
+
+template <typename ColumnStoreData, std::size_t ...KeyIndices>
+class JoinHashTable<ColumnStoreData, std::integer_sequence<std::size_t, KeyIndices...>> {
+public:
+    JoinHashTable (const ColumnStoreData& column_store_data, std::size_t expected_num_rows) : column_store_data_{column_store_data} {
+        entries_.reserve(expected_num_rows);
+        resizeBuckets(std::bit_ceil(std::max(expected_num_rows, MIN_NUM_BUCKETS)));
+    }
+
+    std::size_t getSize () const {
+        return entries_.size();
+    }
+
+    std::uint64_t hashRow (std::size_t row_index) const {
+        return hashColumnStoreRow(column_store_data_.get(), row_index, std::integer_sequence<std::size_t, KeyIndices...>{});
+    }
+
+    void insert (std::size_t row_index) {
+        insert(row_index, hashRow(row_index));
+    }
+
+    void insert (std::size_t row_index, std::uint64_t hash) {
+        if (entries_.size() >= bucket_heads_.size()) {
+            resizeBuckets(bucket_heads_.size() * 2);
+        }
+        entries_.push_back(Entry{hash, row_index, NO_ENTRY});
+        linkEntry(entries_.size() - 1);
+    }
+
+    template <typename ProbeData, std::size_t ...ProbeIndices, typename Func>
+    requires (sizeof...(ProbeIndices) == sizeof...(KeyIndices))
+    void forEachMatch (const ProbeData& probe_data, std::size_t probe_row_index, std::uint64_t hash, std::integer_sequence<std::size_t, ProbeIndices...>, Func&& on_match) const {
+        for (auto entry_index = bucket_heads_[hash & bucket_mask_]; entry_index != NO_ENTRY; entry_index = entries_[entry_index].next) {
+            const auto& entry = entries_[entry_index];
+            if (entry.hash == hash && ((std::get<KeyIndices>(column_store_data_.get())[entry.row_index] == std::get<ProbeIndices>(probe_data)[probe_row_index]) && ...)) {
+                on_match(entry.row_index);
+            }
+        }
+    }
+
+    template <typename ProbeData, std::size_t ...ProbeIndices>
+    requires (sizeof...(ProbeIndices) == sizeof...(KeyIndices))
+    bool containsMatch (const ProbeData& probe_data, std::size_t probe_row_index, std::uint64_t hash, std::integer_sequence<std::size_t, ProbeIndices...>) const {
+        for (auto entry_index = bucket_heads_[hash & bucket_mask_]; entry_index != NO_ENTRY; entry_index = entries_[entry_index].next) {
+            const auto& entry = entries_[entry_index];
+            if (entry.hash == hash && ((std::get<KeyIndices>(column_store_data_.get())[entry.row_index] == std::get<ProbeIndices>(probe_data)[probe_row_index]) && ...)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    static constexpr std::size_t NO_ENTRY = std::numeric_limits<std::size_t>::max();
+    static constexpr std::size_t MIN_NUM_BUCKETS = 16;
+
+    struct Entry {
+        std::uint64_t hash;
+        std::size_t row_index;
+        std::size_t next;
+    };
+
+    void resizeBuckets (std::size_t num_buckets) {
+        bucket_heads_.assign(num_buckets, NO_ENTRY);
+        bucket_tails_.assign(num_buckets, NO_ENTRY);
+        bucket_mask_ = num_buckets - 1;
+        for (auto entry_index = 0LU; entry_index < entries_.size(); ++entry_index) {
+            linkEntry(entry_index);
+        }
+    }
+
+    void linkEntry (std::size_t entry_index) {
+        auto& entry = entries_[entry_index];
+        const auto bucket = entry.hash & bucket_mask_;
+        entry.next = NO_ENTRY;
+        if (bucket_tails_[bucket] == NO_ENTRY) {
+            bucket_heads_[bucket] = entry_index;
+        }
+        else {
+            entries_[bucket_tails_[bucket]].next = entry_index;
+        }
+        bucket_tails_[bucket] = entry_index;
+    }
+
+    std::reference_wrapper<const ColumnStoreData> column_store_data_;
+    std::vector<Entry> entries_{};
+    std::vector<std::size_t> bucket_heads_{};
+    std::vector<std::size_t> bucket_tails_{};
+    std::size_t bucket_mask_{0};
+};
+
+template <typename KeyIndices, typename ColumnStoreData>
+auto buildJoinHashTable (const ColumnStoreData& column_store_data, std::size_t num_rows) {
+    JoinHashTable<ColumnStoreData, KeyIndices> hash_table{column_store_data, num_rows};
+    for (auto row_index = 0LU; row_index < num_rows; ++row_index) {
+        hash_table.insert(row_index);
+    }
+    return hash_table;
+}
+
+/**
+ * Builds the hash table and, if requested, a Bloom filter over the same hashes, such that
+ * the keys of the build side are hashed only once.
+*/
+template <typename KeyIndices, typename ColumnStoreData>
+auto buildJoinHashTable (const ColumnStoreData& column_store_data, std::size_t num_rows, std::optional<BlockedBloomFilter>& bloom_filter) {
+    JoinHashTable<ColumnStoreData, KeyIndices> hash_table{column_store_data, num_rows};
+    for (auto row_index = 0LU; row_index < num_rows; ++row_index) {
+        const auto hash = hash_table.hashRow(row_index);
+        hash_table.insert(row_index, hash);
+        if (bloom_filter) {
+            bloom_filter->insert(hash);
+        }
+    }
+    return hash_table;
+}
+
+// ############################################################################
+// Function: Bloom Filter Usage
+// ############################################################################
+/**
+ * A Bloom filter pays off if most probing rows have no match, which is likely if the build
+ * side is much smaller than the probing side.
+*/
+inline std::optional<BlockedBloomFilter> createJoinBloomFilter (JoinBloomFilter mode, std::size_t build_size, std::size_t probe_size) {
+    static constexpr std::size_t MIN_PROBE_TO_BUILD_RATIO = 8;
+
+    const bool use_bloom_filter = (
+        mode == JoinBloomFilter::Enabled ||
+        (mode == JoinBloomFilter::Auto && probe_size / MIN_PROBE_TO_BUILD_RATIO >= std::max<std::size_t>(build_size, 1))
+    );
+    if (use_bloom_filter) {
+        return BlockedBloomFilter{build_size};
+    }
+    return std::nullopt;
+}
+
+// ############################################################################
+// Function: Tie Columns
+// ############################################################################
+/**
+ * Creates a tuple of references to the selected columns of a column store, such that
+ * the join columns of two DataFrames are accessible by the same (consecutive) indices.
+*/
+template <typename ColumnStoreData, std::size_t ...Indices>
+auto tieColumns (const ColumnStoreData& column_store_data, std::integer_sequence<std::size_t, Indices...>) {
+    return std::tie(std::get<Indices>(column_store_data)...);
+}
+
+// ############################################################################
+// Function: Merge Join
+// ############################################################################
+/**
+ * Merges two column stores sorted ascending by their keys in a single pass. The keys
+ * are compared by the same comparison chain as used for sorting (see ConstructElementComparison).
+ * For every run of equal keys, all combinations of rows of both sides are reported.
+*/
+template <typename KeysLhs, typename KeysRhs, typename Func>
+void mergeJoin (const KeysLhs& keys_lhs, std::size_t size_lhs, const KeysRhs& keys_rhs, std::size_t size_rhs, Func&& on_match) {
+    using KeyComparison = ConstructElementComparison<SortOrder::Ascending, std::make_index_sequence<std::tuple_size_v<KeysLhs>>>;
+
+    auto is_less = [](const auto& data_lhs, std::size_t index_lhs, const auto& data_rhs, std::size_t index_rhs) {
+        return KeyComparison::compare(data_lhs, index_lhs, data_rhs, index_rhs);
+    };
+    auto is_equal = [&is_less](const auto& data_lhs, std::size_t index_lhs, const auto& data_rhs, std::size_t index_rhs) {
+        return not is_less(data_lhs, index_lhs, data_rhs, index_rhs) && not is_less(data_rhs, index_rhs, data_lhs, index_lhs);
+    };
+    auto advance = [&is_less](const auto& keys, std::size_t index, std::size_t size) {
+        if (index < size && is_less(keys, index, keys, index - 1)) {
+            throw JoinException("DataFrame is not sorted ascending by the join columns");
+        }
+        return index;
+    };
+
+    std::size_t index_lhs {0};
+    std::size_t index_rhs {0};
+    while (index_lhs < size_lhs && index_rhs < size_rhs) {
+        if (is_less(keys_lhs, index_lhs, keys_rhs, index_rhs)) {
+            index_lhs = advance(keys_lhs, index_lhs + 1, size_lhs);
+        }
+        else if (is_less(keys_rhs, index_rhs, keys_lhs, index_lhs)) {
+            index_rhs = advance(keys_rhs, index_rhs + 1, size_rhs);
+        }
+        else {
+            auto run_end_lhs = index_lhs + 1;
+            while (run_end_lhs < size_lhs && is_equal(keys_lhs, index_lhs, keys_lhs, run_end_lhs)) {
+                ++run_end_lhs;
+            }
+            auto run_end_rhs = index_rhs + 1;
+            while (run_end_rhs < size_rhs && is_equal(keys_rhs, index_rhs, keys_rhs, run_end_rhs)) {
+                ++run_end_rhs;
+            }
+            for (auto lhs = index_lhs; lhs < run_end_lhs; ++lhs) {
+                for (auto rhs = index_rhs; rhs < run_end_rhs; ++rhs) {
+                    on_match(lhs, rhs);
+                }
+            }
+            index_lhs = advance(keys_lhs, run_end_lhs, size_lhs);
+            index_rhs = advance(keys_rhs, run_end_rhs, size_rhs);
+        }
+    }
+}
+
+// ############################################################################
+// Class: Join Matches
+// ############################################################################
+/**
+ * Pairs of matching row indices of the left and right DataFrame of a join.
+*/
+struct JoinMatches {
+    void reserve (std::size_t num_matches) {
+        row_indices_lhs.reserve(num_matches);
+        row_indices_rhs.reserve(num_matches);
+    }
+
+    void add (std::size_t row_index_lhs, std::size_t row_index_rhs) {
+        row_indices_lhs.push_back(row_index_lhs);
+        row_indices_rhs.push_back(row_index_rhs);
+    }
+
+    std::size_t getSize () const {
+        return row_indices_lhs.size();
+    }
+
+    std::vector<std::size_t> row_indices_lhs {};
+    std::vector<std::size_t> row_indices_rhs {};
+};
+
+/**
+ * Concatenates the matches of multiple partitions into a single list of matches.
+*/
+inline JoinMatches flattenJoinMatches (const std::vector<JoinMatches>& partition_matches, std::size_t num_threads) {
+    std::vector<std::size_t> offsets(partition_matches.size() + 1, 0);
+    for (auto index = 0LU; index < partition_matches.size(); ++index) {
+        offsets[index + 1] = offsets[index] + partition_matches[index].getSize();
+    }
+
+    JoinMatches matches {};
+    matches.row_indices_lhs.resize(offsets.back());
+    matches.row_indices_rhs.resize(offsets.back());
+    parallelFor(partition_matches.size(), num_threads, [&](std::size_t index) {
+        std::ranges::copy(partition_matches[index].row_indices_lhs, matches.row_indices_lhs.begin() + offsets[index]);
+        std::ranges::copy(partition_matches[index].row_indices_rhs, matches.row_indices_rhs.begin() + offsets[index]);
+    });
+    return matches;
+}
+
+/**
+ * Copies the rows referenced by row_indices from column_in to column_out starting at offset.
+ * The column_out must already be sized appropriately.
+ *
+ * Columns of type bool are stored as bitsets by std::vector, such that concurrent writes
+ * to neighboring elements are data races. They are therefore only copied if IsBoolColumnPass
+ * is set, which allows to copy all other columns in parallel.
+*/
+template <bool IsBoolColumnPass, typename ColumnOut, typename ColumnIn>
+void gatherColumn (ColumnOut& column_out, const ColumnIn& column_in, std::span<const std::size_t> row_indices, std::size_t offset) {
+    if constexpr (std::is_same_v<typename ColumnOut::value_type, bool> == IsBoolColumnPass) {
+        for (auto index = 0LU; index < row_indices.size(); ++index) {
+            column_out[offset + index] = column_in[row_indices[index]];
+        }
+    }
+}
+
+// ############################################################################
+// Function: As-Of Join
+// ############################################################################
+/**
+ * Matches every row of the left column store with the last row of the right column store
+ * that has equal keys except for the last one, and a last key less than or equal to the one
+ * of the left row. Left rows without such a row are not reported.
+ *
+ * Both column stores must be sorted ascending by their keys, such that a single merge pass
+ * suffices: all rows of the right side up to the current left row are skipped.
+*/
+template <typename KeysLhs, typename KeysRhs>
+JoinMatches asOfJoin (const KeysLhs& keys_lhs, std::size_t size_lhs, const KeysRhs& keys_rhs, std::size_t size_rhs) {
+    static constexpr std::size_t NUM_KEYS = std::tuple_size_v<KeysLhs>;
+    using KeyComparison = ConstructElementComparison<SortOrder::Ascending, std::make_index_sequence<NUM_KEYS>>;
+
+    auto is_less = [](const auto& data_lhs, std::size_t index_lhs, const auto& data_rhs, std::size_t index_rhs) {
+        return KeyComparison::compare(data_lhs, index_lhs, data_rhs, index_rhs);
+    };
+    auto are_equality_keys_equal = [&]<std::size_t ...Indices>([[maybe_unused]] std::size_t index_lhs, [[maybe_unused]] std::size_t index_rhs, std::integer_sequence<std::size_t, Indices...>) {
+        // a single key has no equality keys, such that the indices are unused
+        return ((std::get<Indices>(keys_lhs)[index_lhs] == std::get<Indices>(keys_rhs)[index_rhs]) && ...);
+    };
+
+    JoinMatches matches {};
+    std::size_t index_rhs {0};
+    for (auto index_lhs = 0LU; index_lhs < size_lhs; ++index_lhs) {
+        if (index_lhs > 0 && is_less(keys_lhs, index_lhs, keys_lhs, index_lhs - 1)) {
+            throw JoinException("DataFrame is not sorted ascending by the join columns");
+        }
+        while (index_rhs < size_rhs && not is_less(keys_lhs, index_lhs, keys_rhs, index_rhs)) {
+            if (index_rhs > 0 && is_less(keys_rhs, index_rhs, keys_rhs, index_rhs - 1)) {
+                throw JoinException("DataFrame is not sorted ascending by the join columns");
+            }
+            ++index_rhs;
+        }
+        if (index_rhs > 0 && are_equality_keys_equal(index_lhs, index_rhs - 1, std::make_index_sequence<NUM_KEYS - 1>{})) {
+            matches.add(index_lhs, index_rhs - 1);
+        }
+    }
+    return matches;
+}
+
+// ############################################################################
+// Function: Nested Loop Join
+// ############################################################################
+template <typename ColumnStoreDataLhs, typename ColumnStoreDataRhs, std::size_t ...KeyIndicesLhs, std::size_t ...KeyIndicesRhs>
+requires (sizeof...(KeyIndicesLhs) == sizeof...(KeyIndicesRhs))
+JoinMatches nestedLoopJoin (const ColumnStoreDataLhs& data_lhs, std::size_t size_lhs, std::integer_sequence<std::size_t, KeyIndicesLhs...>, const ColumnStoreDataRhs& data_rhs, std::size_t size_rhs, std::integer_sequence<std::size_t, KeyIndicesRhs...>) {
+    JoinMatches matches {};
+    for (auto row_index_lhs = 0LU; row_index_lhs < size_lhs; ++row_index_lhs) {
+        for (auto row_index_rhs = 0LU; row_index_rhs < size_rhs; ++row_index_rhs) {
+            if (((std::get<KeyIndicesLhs>(data_lhs)[row_index_lhs] == std::get<KeyIndicesRhs>(data_rhs)[row_index_rhs]) && ...)) {
+                matches.add(row_index_lhs, row_index_rhs);
+            }
+        }
+    }
+    return matches;
+}
+
+// ############################################################################
+// Function: Hash Join
+// ############################################################################
+/**
+ * Builds the hash table on the build column store and calls on_probe(probe_row_index, hash)
+ * for all rows of the probe column store that pass the Bloom filter (if any).
+*/
+template <typename BuildIndices, typename ProbeIndices, typename BuildData, typename ProbeData, typename Func>
+void probeJoinHashTable (const BuildData& build_data, std::size_t build_size, const ProbeData& probe_data, std::size_t probe_size, JoinBloomFilter bloom_filter_mode, Func&& on_probe) {
+    auto bloom_filter = createJoinBloomFilter(bloom_filter_mode, build_size, probe_size);
+    const auto hash_table = buildJoinHashTable<BuildIndices>(build_data, build_size, bloom_filter);
+    for (auto probe_row_index = 0LU; probe_row_index < probe_size; ++probe_row_index) {
+        const auto hash = hashColumnStoreRow(probe_data, probe_row_index, ProbeIndices{});
+        if (not bloom_filter || bloom_filter->mayContain(hash)) {
+            on_probe(hash_table, probe_row_index, hash);
+        }
+    }
+}
+
+/**
+ * Builds the hash table on the build column store and probes it in two passes: the first
+ * pass counts the matches and marks the probing rows with matches in a bitmap, such that the
+ * second pass stores the matches without reallocation and revisits only the marked rows.
+ *
+ * If the build side is the left one, the first pass counts the matches per left row, such that
+ * the second pass places the matches ordered by the left rows (a stable counting sort).
+*/
+template <typename BuildIndices, typename ProbeIndices, typename BuildData, typename ProbeData>
+JoinMatches hashJoinByBuildSide (const BuildData& build_data, std::size_t build_size, const ProbeData& probe_data, std::size_t probe_size, JoinBloomFilter bloom_filter_mode, bool is_build_side_lhs) {
+    auto bloom_filter = createJoinBloomFilter(bloom_filter_mode, build_size, probe_size);
+    const auto hash_table = buildJoinHashTable<BuildIndices>(build_data, build_size, bloom_filter);
+
+    std::vector<std::uint64_t> has_match_bitmap((probe_size + 63) / 64, 0);
+    std::vector<std::size_t> build_offsets(is_build_side_lhs ? build_size + 1 : 0, 0);
+    std::size_t num_matches {0};
+    for (auto probe_row_index = 0LU; probe_row_index < probe_size; ++probe_row_index) {
+        const auto hash = hashColumnStoreRow(probe_data, probe_row_index, ProbeIndices{});
+        if (not bloom_filter || bloom_filter->mayContain(hash)) {
+            const auto num_matches_before = num_matches;
+            hash_table.forEachMatch(probe_data, probe_row_index, hash, ProbeIndices{}, [&](std::size_t build_row_index) {
+                ++num_matches;
+                if (is_build_side_lhs) {
+                    ++build_offsets[build_row_index + 1];
+                }
+            });
+            has_match_bitmap[probe_row_index / 64] |= std::uint64_t{num_matches != num_matches_before} << (probe_row_index % 64);
+        }
+    }
+
+    JoinMatches matches {};
+    if (is_build_side_lhs) {
+        std::partial_sum(build_offsets.begin(), build_offsets.end(), build_offsets.begin());
+        matches.row_indices_lhs.resize(num_matches);
+        matches.row_indices_rhs.resize(num_matches);
+    }
+    else {
+        matches.reserve(num_matches);
+    }
+    for (auto word_index = 0LU; word_index < has_match_bitmap.size(); ++word_index) {
+        for (auto word = has_match_bitmap[word_index]; word != 0; word &= word - 1) {
+            const auto probe_row_index = word_index * 64 + std::countr_zero(word);
+            const auto hash = hashColumnStoreRow(probe_data, probe_row_index, ProbeIndices{});
+            hash_table.forEachMatch(probe_data, probe_row_index, hash, ProbeIndices{}, [&](std::size_t build_row_index) {
+                if (is_build_side_lhs) {
+                    const auto match_index = build_offsets[build_row_index]++;
+                    matches.row_indices_lhs[match_index] = build_row_index;
+                    matches.row_indices_rhs[match_index] = probe_row_index;
+                }
+                else {
+                    matches.add(probe_row_index, build_row_index);
+                }
+            });
+        }
+    }
+    return matches;
+}
+
+/**
+ * Builds the hash table on the smaller column store and probes it with the larger one.
+ * The matches are ordered by the left rows first and by the right rows second, independent
+ * of the build side.
+*/
+template <typename KeyIndicesLhs, typename KeyIndicesRhs, typename ColumnStoreDataLhs, typename ColumnStoreDataRhs>
+JoinMatches hashJoin (const ColumnStoreDataLhs& data_lhs, std::size_t size_lhs, const ColumnStoreDataRhs& data_rhs, std::size_t size_rhs, JoinBloomFilter bloom_filter_mode = JoinBloomFilter::Auto) {
+    if (size_rhs <= size_lhs) {
+        return hashJoinByBuildSide<KeyIndicesRhs, KeyIndicesLhs>(data_rhs, size_rhs, data_lhs, size_lhs, bloom_filter_mode, false);
+    }
+    else {
+        return hashJoinByBuildSide<KeyIndicesLhs, KeyIndicesRhs>(data_lhs, size_lhs, data_rhs, size_rhs, bloom_filter_mode, true);
+    }
+}
+
+// ############################################################################
+// Function: Semi Join
+// ############################################################################
+/**
+ * Determines for each row of the left column store whether a row with equal keys exists
+ * in the right column store (1) or not (0). The hash table is built on the smaller side.
+*/
+template <typename KeyIndicesLhs, typename KeyIndicesRhs, typename ColumnStoreDataLhs, typename ColumnStoreDataRhs>
+std::vector<char> hashSemiJoin (const ColumnStoreDataLhs& data_lhs, std::size_t size_lhs, const ColumnStoreDataRhs& data_rhs, std::size_t size_rhs, JoinBloomFilter bloom_filter_mode = JoinBloomFilter::Auto) {
+    std::vector<char> has_match(size_lhs, 0);
+    if (size_rhs <= size_lhs) {
+        probeJoinHashTable<KeyIndicesRhs, KeyIndicesLhs>(data_rhs, size_rhs, data_lhs, size_lhs, bloom_filter_mode, [&](const auto& hash_table, std::size_t row_index_lhs, std::uint64_t hash) {
+            has_match[row_index_lhs] = hash_table.containsMatch(data_lhs, row_index_lhs, hash, KeyIndicesLhs{});
+        });
+    }
+    else {
+        probeJoinHashTable<KeyIndicesLhs, KeyIndicesRhs>(data_lhs, size_lhs, data_rhs, size_rhs, bloom_filter_mode, [&](const auto& hash_table, std::size_t row_index_rhs, std::uint64_t hash) {
+            hash_table.forEachMatch(data_rhs, row_index_rhs, hash, KeyIndicesRhs{}, [&](std::size_t row_index_lhs) {
+                has_match[row_index_lhs] = 1;
+            });
+        });
+    }
+    return has_match;
+}
+
+template <typename ColumnStoreDataLhs, typename ColumnStoreDataRhs, std::size_t ...KeyIndicesLhs, std::size_t ...KeyIndicesRhs>
+requires (sizeof...(KeyIndicesLhs) == sizeof...(KeyIndicesRhs))
+std::vector<char> nestedLoopSemiJoin (const ColumnStoreDataLhs& data_lhs, std::size_t size_lhs, std::integer_sequence<std::size_t, KeyIndicesLhs...>, const ColumnStoreDataRhs& data_rhs, std::size_t size_rhs, std::integer_sequence<std::size_t, KeyIndicesRhs...>) {
+    std::vector<char> has_match(size_lhs, 0);
+    for (auto row_index_lhs = 0LU; row_index_lhs < size_lhs; ++row_index_lhs) {
+        for (auto row_index_rhs = 0LU; row_index_rhs < size_rhs && not has_match[row_index_lhs]; ++row_index_rhs) {
+            has_match[row_index_lhs] = ((std::get<KeyIndicesLhs>(data_lhs)[row_index_lhs] == std::get<KeyIndicesRhs>(data_rhs)[row_index_rhs]) && ...);
+        }
+    }
+    return has_match;
+}
+
+// ############################################################################
+// Function: Radix Partitioning
+// ############################################################################
+/**
+ * Row indices (and their hashes) of a column store grouped by partition. The rows of
+ * partition p are stored in [offsets[p], offsets[p+1]) in ascending row order.
+*/
+struct RadixPartitions {
+    std::vector<std::size_t> offsets {};
+    std::vector<std::size_t> row_indices {};
+    std::vector<std::uint64_t> hashes {};
+};
+
+constexpr std::size_t getRadixPartition (std::uint64_t hash, std::size_t partition_bits) {
+    // the high bits are used for partitioning, the low bits address the hash table buckets
+    return partition_bits == 0 ? 0 : hash >> (64 - partition_bits);
+}
+
+template <typename KeyIndices, typename ColumnStoreData>
+RadixPartitions radixPartition (const ColumnStoreData& column_store_data, std::size_t num_rows, std::size_t partition_bits, std::size_t num_threads) {
+    const std::size_t num_partitions = std::size_t{1} << partition_bits;
+    const std::size_t num_chunks = std::max(1LU, std::min(getNumThreads(num_threads), num_rows));
+    const std::size_t chunk_size = (num_rows + num_chunks - 1) / num_chunks;
+
+    std::vector<std::uint64_t> hashes_by_row(num_rows);
+    std::vector<std::vector<std::size_t>> histograms(num_chunks, std::vector<std::size_t>(num_partitions, 0));
+    parallelFor(num_chunks, num_threads, [&](std::size_t chunk) {
+        for (auto row_index = chunk * chunk_size; row_index < std::min(num_rows, (chunk + 1) * chunk_size); ++row_index) {
+            hashes_by_row[row_index] = hashColumnStoreRow(column_store_data, row_index, KeyIndices{});
+            ++histograms[chunk][getRadixPartition(hashes_by_row[row_index], partition_bits)];
+        }
+    });
+
+    // turn the histograms into write offsets: partitions first, chunks second to keep the row order
+    RadixPartitions partitions {};
+    partitions.offsets.resize(num_partitions + 1);
+    std::size_t offset {0};
+    for (auto partition = 0LU; partition < num_partitions; ++partition) {
+        partitions.offsets[partition] = offset;
+        for (auto chunk = 0LU; chunk < num_chunks; ++chunk) {
+            const auto count = histograms[chunk][partition];
+            histograms[chunk][partition] = offset;
+            offset += count;
+        }
+    }
+    partitions.offsets[num_partitions] = offset;
+
+    partitions.row_indices.resize(num_rows);
+    partitions.hashes.resize(num_rows);
+    parallelFor(num_chunks, num_threads, [&](std::size_t chunk) {
+        for (auto row_index = chunk * chunk_size; row_index < std::min(num_rows, (chunk + 1) * chunk_size); ++row_index) {
+            const auto hash = hashes_by_row[row_index];
+            const auto target = histograms[chunk][getRadixPartition(hash, partition_bits)]++;
+            partitions.row_indices[target] = row_index;
+            partitions.hashes[target] = hash;
+        }
+    });
+    return partitions;
+}
+
+// ############################################################################
+// Function: Partitioned Hash Join
+// ############################################################################
+/**
+ * Radix-partitions both column stores by the hash of their keys and joins corresponding
+ * partitions in parallel. The number of partitions is chosen such that the hash table of
+ * a single partition fits into the cache. Returns the matches of each partition.
+*/
+template <typename KeyIndicesLhs, typename KeyIndicesRhs, typename ColumnStoreDataLhs, typename ColumnStoreDataRhs>
+std::vector<JoinMatches> partitionedHashJoin (const ColumnStoreDataLhs& data_lhs, std::size_t size_lhs, const ColumnStoreDataRhs& data_rhs, std::size_t size_rhs, std::size_t num_threads) {
+    static constexpr std::size_t TARGET_ROWS_PER_PARTITION = 8192;
+    static constexpr std::size_t MAX_PARTITION_BITS = 12;
+
+    num_threads = getNumThreads(num_threads);
+    const std::size_t build_size = std::min(size_lhs, size_rhs);
+    const std::size_t num_partitions = std::max(build_size / TARGET_ROWS_PER_PARTITION, 4 * num_threads);
+    const std::size_t partition_bits = std::min<std::size_t>(std::bit_width(std::bit_ceil(num_partitions)) - 1, MAX_PARTITION_BITS);
+
+    const auto partitions_lhs = radixPartition<KeyIndicesLhs>(data_lhs, size_lhs, partition_bits, num_threads);
+    const auto partitions_rhs = radixPartition<KeyIndicesRhs>(data_rhs, size_rhs, partition_bits, num_threads);
+
+    auto join_partition = [](const auto& build_data, const RadixPartitions& build_partitions, auto build_key_indices, const auto& probe_data, const RadixPartitions& probe_partitions, auto probe_key_indices, std::size_t partition, auto&& on_match) {
+        using BuildData = std::remove_cvref_t<decltype(build_data)>;
+        JoinHashTable<BuildData, decltype(build_key_indices)> hash_table {build_data, build_partitions.offsets[partition + 1] - build_partitions.offsets[partition]};
+        for (auto index = build_partitions.offsets[partition]; index < build_partitions.offsets[partition + 1]; ++index) {
+            hash_table.insert(build_partitions.row_indices[index], build_partitions.hashes[index]);
+        }
+        for (auto index = probe_partitions.offsets[partition]; index < probe_partitions.offsets[partition + 1]; ++index) {
+            const auto probe_row_index = probe_partitions.row_indices[index];
+            hash_table.forEachMatch(probe_data, probe_row_index, probe_partitions.hashes[index], probe_key_indices, [&](std::size_t build_row_index) {
+                on_match(build_row_index, probe_row_index);
+            });
+        }
+    };
+
+    std::vector<JoinMatches> matches(std::size_t{1} << partition_bits);
+    parallelFor(matches.size(), num_threads, [&](std::size_t partition) {
+        auto& partition_matches = matches[partition];
+        if (size_rhs <= size_lhs) {
+            join_partition(data_rhs, partitions_rhs, KeyIndicesRhs{}, data_lhs, partitions_lhs, KeyIndicesLhs{}, partition, [&](std::size_t row_index_rhs, std::size_t row_index_lhs) {
+                partition_matches.add(row_index_lhs, row_index_rhs);
+            });
+        }
+        else {
+            join_partition(data_lhs, partitions_lhs, KeyIndicesLhs{}, data_rhs, partitions_rhs, KeyIndicesRhs{}, partition, [&](std::size_t row_index_lhs, std::size_t row_index_rhs) {
+                partition_matches.add(row_index_lhs, row_index_rhs);
+            });
+        }
+    });
+    return matches;
+}
+
+} // namespace internal
+
+} // namespace dacr
+
+#endif // DATA_CRUNCHING_INTERNAL_DATAFRAME_JOIN_HPP
@@ -0,0 +1,465 @@
+// Copyright 2022 Andi Hellmund
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+#ifndef DATA_CRUNCHING_INTERNAL_DATAFRAME_ROLLING_HPP
+#define DATA_CRUNCHING_INTERNAL_DATAFRAME_ROLLING_HPP
+
+#include <cmath>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "data_crunching/internal/dataframe_summarize.hpp"
+#include "data_crunching/internal/fixed_string.hpp"
+#include "data_crunching/internal/name_list.hpp"
+#include "data_crunching/internal/type_list.hpp"
+#include "data_crunching/internal/utils.hpp"
+#include "data_crunching/internal/column.hpp"
+
+namespace dacr {
+
+/**
+ * Window of the last Size rows up to and including the current row. If partitioned, the window
+ * only contains rows with the same values in the columns PartitionNames.
+*/
+template <std::size_t Size, FixedString ...PartitionNames>
+requires (Size > 0)
+struct Window {
+    static constexpr std::size_t SIZE = Size;
+    static constexpr std::size_t NumColumns = sizeof...(PartitionNames);
+    using Names = internal::NameList<PartitionNames...>;
+    using PartitionBy = GroupBy<PartitionNames...>;
+};
+
+namespace internal {
+
+// ############################################################################
+// Concept: Is Window Spec
+// ############################################################################
+template <typename>
+struct IsWindowSpecImpl : std::false_type {};
+
+template <std::size_t Size, FixedString ...PartitionNames>
+struct IsWindowSpecImpl<Window<Size, PartitionNames...>> : std::true_type {};
+
+template <typename T>
+concept IsWindowSpec = IsWindowSpecImpl<T>::value;
+
+// ############################################################################
+// Trait: Are Rolling Ops
+// ############################################################################
+/**
+ * Ops whose state supports removing the oldest value of the window in amortized constant time.
+*/
+template <typename>
+struct IsRollingOpImpl : std::false_type {};
+
+template <FixedString ColumnName, FixedString NewColumnName>
+struct IsRollingOpImpl<Sum<ColumnName, NewColumnName>> : std::true_type {};
+
+template <FixedString ColumnName, FixedString NewColumnName>
+struct IsRollingOpImpl<Avg<ColumnName, NewColumnName>> : std::true_type {};
+
+template <FixedString ColumnName, FixedString NewColumnName>
+struct IsRollingOpImpl<Min<ColumnName, NewColumnName>> : std::true_type {};
+
+template <FixedString ColumnName, FixedString NewColumnName>
+struct IsRollingOpImpl<Max<ColumnName, NewColumnName>> : std::true_type {};
+
+template <FixedString ColumnName, FixedString NewColumnName>
+struct IsRollingOpImpl<CountIf<ColumnName, NewColumnName>> : std::true_type {};
+
+template <FixedString ColumnName, FixedString NewColumnName>
+struct IsRollingOpImpl<CountIfNot<ColumnName, NewColumnName>> : std::true_type {};
+
+template <typename ...>
+struct AreRollingOpsImpl : std::false_type {};
+
+template <typename ...Ops>
+struct AreRollingOpsImpl<TypeList<Ops...>> {
+    static constexpr bool value = (IsRollingOpImpl<Ops>::value && ...);
+};
+
+template <typename Ops>
+constexpr bool are_rolling_ops = AreRollingOpsImpl<Ops>::value;
+
+// ############################################################################
+// Class: Rolling Aggregators
+// ############################################################################
+/**
+ * Sum that supports removing values. Floating-point values are summed with the compensation
+ * of Neumaier, such that the rounding errors of adding and removing values do not accumulate
+ * over long series. Infinite values are counted instead of summed, as subtracting them would
+ * turn the sum into NaN for good: the sum is infinite (or NaN for both signs) while they are added.
+*/
+template <IsArithmetic T>
+class CompensatedSum {
+public:
+    void add (T value) {
+        if constexpr (std::is_floating_point_v<T>) {
+            if (std::isinf(value)) {
+                ++(value > 0 ? num_positive_infinities_ : num_negative_infinities_);
+                return;
+            }
+            const T sum = sum_ + value;
+            compensation_ += std::abs(sum_) >= std::abs(value) ? (sum_ - sum) + value : (value - sum) + sum_;
+            sum_ = sum;
+        }
+        else {
+            sum_ += value;
+        }
+    }
+
+    void remove (T value) {
+        if constexpr (std::is_floating_point_v<T>) {
+            if (std::isinf(value)) {
+                --(value > 0 ? num_positive_infinities_ : num_negative_infinities_);
+                return;
+            }
+        }
+        add(-value);
+    }
+
+    T getSum () const {
+        if constexpr (std::is_floating_point_v<T>) {
+            if (num_positive_infinities_ > 0 && num_negative_infinities_ > 0) {
+                return std::numeric_limits<T>::quiet_NaN();
+            }
+            if (num_positive_infinities_ > 0 || num_negative_infinities_ > 0) {
+                return num_positive_infinities_ > 0 ? std::numeric_limits<T>::infinity() : -std::numeric_limits<T>::infinity();
+            }
+        }
+        return sum_ + compensation_;
+    }
+
+private:
+    T sum_ {0};
+    T compensation_ {0};
+    std::size_t num_positive_infinities_ {0};
+    std::size_t num_negative_infinities_ {0};
+};
+
+/**
+ * NaN values are ignored by the rolling aggregators, as by the summarizers of Min and Max.
+*/
+template <typename T>
+bool isNaN (T value) {
+    if constexpr (std::is_floating_point_v<T>) {
+        return std::isnan(value);
+    }
+    else {
+        return false;
+    }
+}
+
+/**
+ * Rolling aggregators add the value of a row entering the window and remove the value of the row
+ * leaving the window. The position is the index of the row within its partition.
+*/
+template <std::size_t InIndex, IsArithmetic T>
+class RollingSum {
+public:
+    using TargetType = T;
+
+    template <typename DataIn>
+    void add (const DataIn& in, std::size_t row_index, std::size_t) {
+        const T value = std::get<InIndex>(in)[row_index];
+        if (not isNaN(value)) {
+            sum_.add(value);
+        }
+    }
+
+    template <typename DataIn>
+    void remove (const DataIn& in, std::size_t row_index, std::size_t) {
+        const T value = std::get<InIndex>(in)[row_index];
+        if (not isNaN(value)) {
+            sum_.remove(value);
+        }
+    }
+
+    T getState () const {
+        return sum_.getSum();
+    }
+
+private:
+    CompensatedSum<T> sum_{};
+};
+
+template <std::size_t InIndex, IsArithmetic T>
+class RollingAvg {
+public:
+    using TargetType = double;
+
+    template <typename DataIn>
+    void add (const DataIn& in, std::size_t row_index, std::size_t) {
+        const T value = std::get<InIndex>(in)[row_index];
+        if (not isNaN(value)) {
+            sum_.add(static_cast<double>(value));
+            count_ += 1;
+        }
+    }
+
+    template <typename DataIn>
+    void remove (const DataIn& in, std::size_t row_index, std::size_t) {
+        const T value = std::get<InIndex>(in)[row_index];
+        if (not isNaN(value)) {
+            sum_.remove(static_cast<double>(value));
+            count_ -= 1;
+        }
+    }
+
+    double getState () const {
+        return count_ > 0 ? sum_.getSum() / static_cast<double>(count_) : 0.0;
+    }
+
+private:
+    CompensatedSum<double> sum_{};
+    std::size_t count_ {0};
+};
+
+/**
+ * Minimum (or maximum) of the window by a monotonic deque: a value is dropped from the back once
+ * a newer value is at least as small, as it cannot become the minimum anymore. Hence, the front
+ * is the minimum of the window and every value is added and removed once. NaN values are ignored.
+*/
+template <std::size_t InIndex, IsArithmetic T, typename Compare>
+class RollingExtremum {
+public:
+    using TargetType = T;
+
+    template <typename DataIn>
+    void add (const DataIn& in, std::size_t row_index, std::size_t position) {
+        const T value = std::get<InIndex>(in)[row_index];
+        if (isNaN(value)) {
+            return;
+        }
+        while (not candidates_.empty() && not Compare{}(candidates_.back().second, value)) {
+            candidates_.pop_back();
+        }
+        candidates_.emplace_back(position, value);
+    }
+
+    template <typename DataIn>
+    void remove (const DataIn&, std::size_t, std::size_t position) {
+        if (not candidates_.empty() && candidates_.front().first == position) {
+            candidates_.pop_front();
+        }
+    }
+
+    T getState () const {
+        if (candidates_.empty()) {
+            // as the summarizers of Min and Max
+            return std::is_same_v<Compare, std::less<T>> ? std::numeric_limits<T>::max() : std::numeric_limits<T>::lowest();
+        }
+        return candidates_.front().second;
+    }
+
+private:
+    std::deque<std::pair<std::size_t, T>> candidates_{};
+};
+
+template <std::size_t InIndex, IsArithmetic T>
+using RollingMin = RollingExtremum<InIndex, T, std::less<T>>;
+
+template <std::size_t InIndex, IsArithmetic T>
+using RollingMax = RollingExtremum<InIndex, T, std::greater<T>>;
+
+template <std::size_t InIndex, bool Value>
+class RollingCount {
+public:
+    using TargetType = int;
+
+    template <typename DataIn>
+    void add (const DataIn& in, std::size_t row_index, std::size_t) {
+        count_ += (std::get<InIndex>(in)[row_index] == Value);
+    }
+
+    template <typename DataIn>
+    void remove (const DataIn& in, std::size_t row_index, std::size_t) {
+        count_ -= (std::get<InIndex>(in)[row_index] == Value);
+    }
+
+    int getState () const {
+        return count_;
+    }
+
+private:
+    int count_ {0};
+};
+
+template <std::size_t InIndex, typename T>
+requires (std::is_same_v<T, bool>)
+using RollingCountIf = RollingCount<InIndex, true>;
+
+template <std::size_t InIndex, typename T>
+requires (std::is_same_v<T, bool>)
+using RollingCountIfNot = RollingCount<InIndex, false>;
+
+// ############################################################################
+// Trait: Get Rolling Aggregator For Op
+// ############################################################################
+template <typename ...>
+struct GetRollingAggregatorForOpImpl {};
+
+template <FixedString ColumnName, FixedString NewColumnName, typename ...Columns>
+struct GetRollingAggregatorForOpImpl<Sum<ColumnName, NewColumnName>, Columns...> {
+    using type = RollingSum<get_column_index_by_name<ColumnName, Columns...>, GetColumnTypeByName<ColumnName, Columns...>>;
+};
+
+template <FixedString ColumnName, FixedString NewColumnName, typename ...Columns>
+struct GetRollingAggregatorForOpImpl<Avg<ColumnName, NewColumnName>, Columns...> {
+    using type = RollingAvg<get_column_index_by_name<ColumnName, Columns...>, GetColumnTypeByName<ColumnName, Columns...>>;
+};
+
+template <FixedString ColumnName, FixedString NewColumnName, typename ...Columns>
+struct GetRollingAggregatorForOpImpl<Min<ColumnName, NewColumnName>, Columns...> {
+    using type = RollingMin<get_column_index_by_name<ColumnName, Columns...>, GetColumnTypeByName<ColumnName, Columns...>>;
+};
+
+template <FixedString ColumnName, FixedString NewColumnName, typename ...Columns>
+struct GetRollingAggregatorForOpImpl<Max<ColumnName, NewColumnName>, Columns...> {
+    using type = RollingMax<get_column_index_by_name<ColumnName, Columns...>, GetColumnTypeByName<ColumnName, Columns...>>;
+};
+
+template <FixedString ColumnName, FixedString NewColumnName, typename ...Columns>
+struct GetRollingAggregatorForOpImpl<CountIf<ColumnName, NewColumnName>, Columns...> {
+    using type = RollingCountIf<get_column_index_by_name<ColumnName, Columns...>, GetColumnTypeByName<ColumnName, Columns...>>;
+};
+
+template <FixedString ColumnName, FixedString NewColumnName, typename ...Columns>
+struct GetRollingAggregatorForOpImpl<CountIfNot<ColumnName, NewColumnName>, Columns...> {
+    using type = RollingCountIfNot<get_column_index_by_name<ColumnName, Columns...>, GetColumnTypeByName<ColumnName, Columns...>>;
+};
+
+template <typename Op, typename ...Columns>
+using GetRollingAggregatorForOp = typename GetRollingAggregatorForOpImpl<Op, Columns...>::type;
+
+// ############################################################################
+// Class: Rolling Executer
+// ############################################################################
+/**
+ * Computes the aggregators over the window of every row. Each partition is processed as one
+ * series: every row enters and leaves the window once, such that the runtime is linear in the
+ * number of rows independent of the window size.
+*/
+template <std::size_t WindowSize, typename ...Aggregators>
+class RollingExecuter {
+public:
+    using Results = std::tuple<std::vector<typename Aggregators::TargetType>...>;
+
+    explicit RollingExecuter (std::size_t num_rows) : results_{std::vector<typename Aggregators::TargetType>(num_rows)...} {}
+
+    /**
+     * Rolls the window over the rows of a partition, given by their row indices in order.
+    */
+    template <typename ColumnStoreData, std::ranges::random_access_range RowIndices>
+    void rollPartition (const ColumnStoreData& column_store_data, const RowIndices& row_indices) {
+        rollPartitionImpl(column_store_data, row_indices, std::index_sequence_for<Aggregators...>{});
+    }
+
+    Results& getResults () {
+        return results_;
+    }
+
+private:
+    template <typename ColumnStoreData, typename RowIndices, std::size_t ...AggregatorIndices>
+    void rollPartitionImpl (const ColumnStoreData& column_store_data, const RowIndices& row_indices, std::integer_sequence<std::size_t, AggregatorIndices...>) {
+        std::tuple<Aggregators...> aggregators{};
+        const std::size_t num_rows = std::ranges::size(row_indices);
+        for (auto position = 0LU; position < num_rows; ++position) {
+            if (position >= WindowSize) {
+                const std::size_t leaving_position = position - WindowSize;
+                const std::size_t leaving_row_index = row_indices[leaving_position];
+                (std::get<AggregatorIndices>(aggregators).remove(column_store_data, leaving_row_index, leaving_position), ...);
+            }
+            const std::size_t row_index = row_indices[position];
+            (std::get<AggregatorIndices>(aggregators).add(column_store_data, row_index, position), ...);
+            ((std::get<AggregatorIndices>(results_)[row_index] = std::get<AggregatorIndices>(aggregators).getState()), ...);
+        }
+    }
+
+    Results results_;
+};
+
+/**
+ * Returns the row indices ordered by partition (in the order of the first appearance of each
+ * partition) and the offsets of the partitions within the row indices. The partitions are
+ * found by the group-by of the summarization.
+*/
+template <typename PartitionBy, typename PartitionColumnIndices, typename PartitionTypes, typename ColumnStoreData>
+std::pair<std::vector<std::size_t>, std::vector<std::size_t>> partitionRows (const ColumnStoreData& column_store_data, std::size_t num_rows) {
+    // the executer summarizes nothing and constructs no result DataFrame
+    using Executer = SummarizationExecuterGroupBy<
+        void, PartitionColumnIndices, PartitionTypes, CompoundSummarizer<>, SummarizeStrategy::Hash,
+        GetKeyDomain<PartitionBy, PartitionTypes>
+    >;
+    Executer executer{};
+    std::vector<std::size_t> partition_of_row(num_rows);
+    for (auto row_index = 0LU; row_index < num_rows; ++row_index) {
+        partition_of_row[row_index] = executer.getOrCreateGroupIndex(column_store_data, row_index);
+    }
+
+    std::vector<std::size_t> offsets(executer.getNumGroups() + 1, 0);
+    for (auto partition : partition_of_row) {
+        ++offsets[partition + 1];
+    }
+    for (auto partition = 0LU; partition < executer.getNumGroups(); ++partition) {
+        offsets[partition + 1] += offsets[partition];
+    }
+    std::vector<std::size_t> row_indices(num_rows);
+    std::vector<std::size_t> next_positions(offsets.begin(), offsets.end() - 1);
+    for (auto row_index = 0LU; row_index < num_rows; ++row_index) {
+        row_indices[next_positions[partition_of_row[row_index]]++] = row_index;
+    }
+    return {std::move(row_indices), std::move(offsets)};
+}
+
+/**
+ * Computes the rolling aggregations of the ops and returns one result column per op.
+*/
+template <typename WindowSpec, typename PartitionColumnIndices, typename PartitionTypes, typename Ops, typename ...Columns>
+struct RollingComputation {};
+
+template <typename WindowSpec, typename PartitionColumnIndices, typename PartitionTypes, typename ...Ops, typename ...Columns>
+struct RollingComputation<WindowSpec, PartitionColumnIndices, PartitionTypes, TypeList<Ops...>, Columns...> {
+    template <typename ColumnStoreData>
+    static auto compute (const ColumnStoreData& column_store_data, std::size_t num_rows) {
+        RollingExecuter<WindowSpec::SIZE, GetRollingAggregatorForOp<Ops, Columns...>...> executer{num_rows};
+        if constexpr (WindowSpec::NumColumns == 0) {
+            executer.rollPartition(column_store_data, std::views::iota(0LU, num_rows));
+        }
+        else {
+            const auto [row_indices, offsets] = partitionRows<typename WindowSpec::PartitionBy, PartitionColumnIndices, PartitionTypes>(column_store_data, num_rows);
+            for (auto partition = 0LU; partition + 1 < offsets.size(); ++partition) {
+                executer.rollPartition(
+                    column_store_data,
+                    std::span<const std::size_t>{row_indices.data() + offsets[partition], offsets[partition + 1] - offsets[partition]}
+                );
+            }
+        }
+        return std::move(executer.getResults());
+    }
+};
+
+} // namespace internal
+
+} // namespace dacr
+
+#endif // DATA_CRUNCHING_INTERNAL_DATAFRAME_ROLLING_HPP
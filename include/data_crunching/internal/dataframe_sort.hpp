@@ -33,23 +33,32 @@ template <SortOrder Order, std::size_t CompareIndex, typename RecursiveSortCompa
 struct CompareElementsForSort {
     template <typename DataIn>
     static bool compare(const DataIn& data_in, std::size_t index_lhs, std::size_t index_rhs) {
+        return compare(data_in, index_lhs, data_in, index_rhs);
+    }
+
+    /**
+     * Compares rows of two (possibly different) column stores, e.g. to merge two sorted DataFrames.
+     * Both column stores must provide the columns to compare at the same indices.
+    */
+    template <typename DataLhs, typename DataRhs>
+    static bool compare(const DataLhs& data_lhs, std::size_t index_lhs, const DataRhs& data_rhs, std::size_t index_rhs) {
         if constexpr (Order == SortOrder::Ascending) {
             if constexpr (std::is_same_v<RecursiveSortCompare, void>) {
-                return std::get<CompareIndex>(data_in)[index_lhs] < std::get<CompareIndex>(data_in)[index_rhs];
+                return std::get<CompareIndex>(data_lhs)[index_lhs] < std::get<CompareIndex>(data_rhs)[index_rhs];
             }
             else {
-                return (std::get<CompareIndex>(data_in)[index_lhs] < std::get<CompareIndex>(data_in)[index_rhs] || (
-                    std::get<CompareIndex>(data_in)[index_lhs] == std::get<CompareIndex>(data_in)[index_rhs] && RecursiveSortCompare::compare(data_in, index_lhs, index_rhs)
+                return (std::get<CompareIndex>(data_lhs)[index_lhs] < std::get<CompareIndex>(data_rhs)[index_rhs] || (
+                    std::get<CompareIndex>(data_lhs)[index_lhs] == std::get<CompareIndex>(data_rhs)[index_rhs] && RecursiveSortCompare::compare(data_lhs, index_lhs, data_rhs, index_rhs)
                 ));
             }
         }
         else {
             if constexpr (std::is_same_v<RecursiveSortCompare, void>) {
-                return std::get<CompareIndex>(data_in)[index_lhs] > std::get<CompareIndex>(data_in)[index_rhs];
+                return std::get<CompareIndex>(data_lhs)[index_lhs] > std::get<CompareIndex>(data_rhs)[index_rhs];
             }
             else {
-                return (std::get<CompareIndex>(data_in)[index_lhs] > std::get<CompareIndex>(data_in)[index_rhs] || (
-                    std::get<CompareIndex>(data_in)[index_lhs] == std::get<CompareIndex>(data_in)[index_rhs] && RecursiveSortCompare::compare(data_in, index_lhs, index_rhs)
+                return (std::get<CompareIndex>(data_lhs)[index_lhs] > std::get<CompareIndex>(data_rhs)[index_rhs] || (
+                    std::get<CompareIndex>(data_lhs)[index_lhs] == std::get<CompareIndex>(data_rhs)[index_rhs] && RecursiveSortCompare::compare(data_lhs, index_lhs, data_rhs, index_rhs)
                 ));
             }
         }
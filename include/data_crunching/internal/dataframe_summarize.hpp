@@ -12,12 +12,33 @@
 //  See the License for the specific language governing permissions and
 //  limitations under the License.
 
-#ifndef DATA_CRUNCHING_INTERNAL_DATAFRDATA_CRUNCHING_INTERNAL_DATAFRAME_SUMMARIZE_HPPAME_SUMMARIZE_HPP
+#ifndef DATA_CRUNCHING_INTERNAL_DATAFRAME_SUMMARIZE_HPP
 #define DATA_CRUNCHING_INTERNAL_DATAFRAME_SUMMARIZE_HPP
 
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include "data_crunching/internal/arena.hpp"
+#include "data_crunching/internal/column_kernels.hpp"
+#include "data_crunching/internal/dataframe_sort.hpp"
 #include "data_crunching/internal/fixed_string.hpp"
+#include "data_crunching/internal/hash.hpp"
+#include "data_crunching/internal/hyperloglog.hpp"
 #include "data_crunching/internal/utils.hpp"
 #include "data_crunching/internal/name_list.hpp"
+#include "data_crunching/internal/parallel.hpp"
+#include "data_crunching/internal/tdigest.hpp"
 #include "data_crunching/internal/type_list.hpp"
 #include "data_crunching/internal/column.hpp"
 
@@ -31,6 +52,17 @@ struct GroupBy {
 
 using GroupByNone = GroupBy<>;
 
+/**
+ * Group-by of a single integral or enum column whose values are in [DomainBegin, DomainEnd).
+ * The groups are indexed directly by the value instead of a hash table.
+*/
+template <FixedString GroupByName, long long DomainBegin, long long DomainEnd>
+requires (DomainBegin < DomainEnd && DomainEnd - DomainBegin <= (1LL << 24))
+struct GroupByDomain {
+    static constexpr std::size_t NumColumns = 1;
+    using Names = internal::NameList<GroupByName>;
+};
+
 template <FixedString ColumnName, FixedString NewColumnName>
 struct Sum {};
 
@@ -46,12 +78,74 @@ struct Avg {};
 template <FixedString ColumnName, FixedString NewColumnName>
 struct StdDev {};
 
+template <FixedString ColumnName, FixedString NewColumnName>
+struct SampleStdDev {};
+
+template <FixedString ColumnName, FixedString NewColumnName>
+struct Variance {};
+
+template <FixedString ColumnName, FixedString NewColumnName>
+struct SampleVariance {};
+
+template <FixedString ColumnName, FixedString NewColumnName>
+struct Skewness {};
+
+template <FixedString ColumnName, FixedString NewColumnName>
+struct Kurtosis {};
+
 template <FixedString ColumnName, FixedString NewColumnName>
 struct CountIf {};
 
 template <FixedString ColumnName, FixedString NewColumnName>
 struct CountIfNot {};
 
+/**
+ * Approximate number of distinct values by a HyperLogLog sketch of 2^Precision bytes
+ * with a relative standard error of about 1.04 / sqrt(2^Precision).
+*/
+template <FixedString ColumnName, FixedString NewColumnName, std::size_t Precision = 12>
+requires (Precision >= 4 && Precision <= 18)
+struct CountDistinctApprox {};
+
+/**
+ * Approximate Percentile-th percentile (e.g. 99 for p99) by a t-digest.
+*/
+template <FixedString ColumnName, FixedString NewColumnName, std::size_t Percentile>
+requires (Percentile <= 100)
+struct Quantile {};
+
+template <FixedString ColumnName, FixedString NewColumnName>
+struct Median {};
+
+/**
+ * Exact Percentile-th percentile, linearly interpolated between the closest ranks.
+*/
+template <FixedString ColumnName, FixedString NewColumnName, std::size_t Percentile>
+requires (Percentile <= 100)
+struct ExactQuantile {};
+
+template <FixedString ColumnName, FixedString NewColumnName>
+struct ExactMedian {};
+
+enum class SummarizeStrategy {
+    /* find the group of each row by a hash table over the group-by columns */
+    Hash = 0,
+    /* the rows of each group are contiguous (e.g. sorted by the group-by columns): groups are detected as runs */
+    SortedRuns,
+};
+
+class SummarizeException : public std::runtime_error {
+public:
+    using std::runtime_error::runtime_error;
+};
+
+struct SummarizeOptions {
+    /* number of threads to summarize the rows. The value 0 refers to all hardware threads. Default: serial */
+    std::size_t num_threads {1};
+    /* algorithm used to find the group of a row. Ignored for GroupByNone */
+    SummarizeStrategy strategy {SummarizeStrategy::Hash};
+};
+
 namespace internal {
 
 // ############################################################################
@@ -66,9 +160,49 @@ struct IsGroupBySpecImpl<GroupBy<GroupByNames...>> : std::true_type {};
 template <>
 struct IsGroupBySpecImpl<GroupByNone> : std::true_type {};
 
+template <FixedString GroupByName, long long DomainBegin, long long DomainEnd>
+struct IsGroupBySpecImpl<GroupByDomain<GroupByName, DomainBegin, DomainEnd>> : std::true_type {};
+
 template <typename T>
 concept IsGroupBySpec = IsGroupBySpecImpl<T>::value;
 
+// ############################################################################
+// Trait: Get Key Domain
+// ############################################################################
+/**
+ * Domain [Begin, End) of the values of a single group-by column, such that groups are indexed
+ * directly by the value. Single-byte integral types (bool, char) always have a small domain.
+*/
+template <long long Begin, long long End>
+struct KeyDomain {
+    static constexpr long long BEGIN = Begin;
+    static constexpr std::size_t SIZE = static_cast<std::size_t>(End - Begin);
+};
+
+struct NoKeyDomain {
+    static constexpr std::size_t SIZE = 0;
+};
+
+template <typename GroupBySpec, typename GroupByTypes>
+struct GetKeyDomainImpl {
+    using type = NoKeyDomain;
+};
+
+template <FixedString GroupByName, typename T>
+requires (std::is_integral_v<T> && sizeof(T) == 1)
+struct GetKeyDomainImpl<GroupBy<GroupByName>, std::tuple<T>> {
+    using type = KeyDomain<std::numeric_limits<T>::min(), static_cast<long long>(std::numeric_limits<T>::max()) + 1>;
+};
+
+template <FixedString GroupByName, long long DomainBegin, long long DomainEnd, typename T>
+struct GetKeyDomainImpl<GroupByDomain<GroupByName, DomainBegin, DomainEnd>, std::tuple<T>> {
+    static_assert(std::is_integral_v<T> || std::is_enum_v<T>, "GroupByDomain requires an integral or enum group-by column");
+    using type = KeyDomain<DomainBegin, DomainEnd>;
+};
+
+template <typename GroupBySpec, typename GroupByTypes>
+using GetKeyDomain = typename GetKeyDomainImpl<GroupBySpec, GroupByTypes>::type;
+
 // ############################################################################
 // Concept: Is Summarize Op
 // ############################################################################
@@ -91,15 +225,95 @@ struct IsSummarizeOpImpl<Avg<ColumnName, NewColumnName>> : std::true_type {};
 template <FixedString ColumnName, FixedString NewColumnName>
 struct IsSummarizeOpImpl<StdDev<ColumnName, NewColumnName>> : std::true_type {};
 
+template <FixedString ColumnName, FixedString NewColumnName>
+struct IsSummarizeOpImpl<SampleStdDev<ColumnName, NewColumnName>> : std::true_type {};
+
+template <FixedString ColumnName, FixedString NewColumnName>
+struct IsSummarizeOpImpl<Variance<ColumnName, NewColumnName>> : std::true_type {};
+
+template <FixedString ColumnName, FixedString NewColumnName>
+struct IsSummarizeOpImpl<SampleVariance<ColumnName, NewColumnName>> : std::true_type {};
+
+template <FixedString ColumnName, FixedString NewColumnName>
+struct IsSummarizeOpImpl<Skewness<ColumnName, NewColumnName>> : std::true_type {};
+
+template <FixedString ColumnName, FixedString NewColumnName>
+struct IsSummarizeOpImpl<Kurtosis<ColumnName, NewColumnName>> : std::true_type {};
+
 template <FixedString ColumnName, FixedString NewColumnName>
 struct IsSummarizeOpImpl<CountIf<ColumnName, NewColumnName>> : std::true_type {};
 
 template <FixedString ColumnName, FixedString NewColumnName>
 struct IsSummarizeOpImpl<CountIfNot<ColumnName, NewColumnName>> : std::true_type {};
 
+template <FixedString ColumnName, FixedString NewColumnName, std::size_t Precision>
+struct IsSummarizeOpImpl<CountDistinctApprox<ColumnName, NewColumnName, Precision>> : std::true_type {};
+
+template <FixedString ColumnName, FixedString NewColumnName, std::size_t Percentile>
+struct IsSummarizeOpImpl<Quantile<ColumnName, NewColumnName, Percentile>> : std::true_type {};
+
+template <FixedString ColumnName, FixedString NewColumnName>
+struct IsSummarizeOpImpl<Median<ColumnName, NewColumnName>> : std::true_type {};
+
+template <FixedString ColumnName, FixedString NewColumnName, std::size_t Percentile>
+struct IsSummarizeOpImpl<ExactQuantile<ColumnName, NewColumnName, Percentile>> : std::true_type {};
+
+template <FixedString ColumnName, FixedString NewColumnName>
+struct IsSummarizeOpImpl<ExactMedian<ColumnName, NewColumnName>> : std::true_type {};
+
 template <typename T>
 concept IsSummarizeOp = IsSummarizeOpImpl<T>::value;
 
+// ############################################################################
+// Concept: Is Parameterized Summarize Op
+// ############################################################################
+/**
+ * Ops with template parameters besides the column names require dedicated specializations
+ * of the op traits: compilers differ in whether they match a template template parameter
+ * of only the two column names.
+*/
+template <typename>
+struct IsParameterizedSummarizeOpImpl : std::false_type {};
+
+template <FixedString ColumnName, FixedString NewColumnName, std::size_t Precision>
+struct IsParameterizedSummarizeOpImpl<CountDistinctApprox<ColumnName, NewColumnName, Precision>> : std::true_type {};
+
+template <FixedString ColumnName, FixedString NewColumnName, std::size_t Percentile>
+struct IsParameterizedSummarizeOpImpl<Quantile<ColumnName, NewColumnName, Percentile>> : std::true_type {};
+
+template <FixedString ColumnName, FixedString NewColumnName, std::size_t Percentile>
+struct IsParameterizedSummarizeOpImpl<ExactQuantile<ColumnName, NewColumnName, Percentile>> : std::true_type {};
+
+template <typename T>
+concept IsParameterizedSummarizeOp = IsParameterizedSummarizeOpImpl<T>::value;
+
+// ############################################################################
+// Trait: Are Incremental Summarize Ops
+// ############################################################################
+/**
+ * Ops whose state has constant size per group, such that appended rows are summarized in time
+ * linear in the number of new rows. The exact quantiles buffer and select all values of a group.
+*/
+template <typename Op>
+struct IsIncrementalSummarizeOpImpl : std::true_type {};
+
+template <FixedString ColumnName, FixedString NewColumnName, std::size_t Percentile>
+struct IsIncrementalSummarizeOpImpl<ExactQuantile<ColumnName, NewColumnName, Percentile>> : std::false_type {};
+
+template <FixedString ColumnName, FixedString NewColumnName>
+struct IsIncrementalSummarizeOpImpl<ExactMedian<ColumnName, NewColumnName>> : std::false_type {};
+
+template <typename ...>
+struct AreIncrementalSummarizeOpsImpl : std::false_type {};
+
+template <typename ...Ops>
+struct AreIncrementalSummarizeOpsImpl<TypeList<Ops...>> {
+    static constexpr bool value = (IsIncrementalSummarizeOpImpl<Ops>::value && ...);
+};
+
+template <typename Ops>
+constexpr bool are_incremental_summarize_ops = AreIncrementalSummarizeOpsImpl<Ops>::value;
+
 // ############################################################################
 // Concept: Trait Summarizer
 // ############################################################################
@@ -113,6 +327,16 @@ public:
         sum_ += std::get<InIndex>(in)[index];
     }
 
+    template <typename DataIn>
+    requires (not std::is_same_v<T, bool>)
+    void summarizeRange (const DataIn& in, std::size_t begin, std::size_t end) {
+        sum_ += reduceSum<T>(std::get<InIndex>(in).data() + begin, end - begin);
+    }
+
+    void merge (const SummarizerSum& other) {
+        sum_ += other.sum_;
+    }
+
     T getState () const {
         return sum_;
     }
@@ -132,44 +356,237 @@ public:
         current_average_ = current_average_ + (static_cast<double>(std::get<InIndex>(in)[index]) - current_average_) / current_count_;
     }
 
+    template <typename DataIn>
+    requires (not std::is_same_v<T, bool>)
+    void summarizeRange (const DataIn& in, std::size_t begin, std::size_t end) {
+        if (end > begin) {
+            SummarizerAvg range{};
+            range.current_count_ = end - begin;
+            range.current_average_ = reduceSum<double>(std::get<InIndex>(in).data() + begin, end - begin) / range.current_count_;
+            merge(range);
+        }
+    }
+
+    void merge (const SummarizerAvg& other) {
+        if (other.current_count_ > 0) {
+            current_count_ += other.current_count_;
+            current_average_ = current_average_ + (other.current_average_ - current_average_) * other.current_count_ / current_count_;
+        }
+    }
+
     double getState () const {
         return current_average_;
     }
 
 private:
     double current_average_ {0};
-    int current_count_{0};
+    std::size_t current_count_ {0};
 };
 
-template <std::size_t InIndex, IsArithmetic T>
-class SummarizerStdDev {
+// ############################################################################
+// Class: Central Moments
+// ############################################################################
+template <std::size_t Id>
+struct UnusedState {};
+
+/**
+ * Streaming central moments up to MaxOrder (1 to 4) in constant memory. Moments above
+ * MaxOrder are neither computed nor stored.
+ *
+ * Values are added by the single-pass update of Welford (extended to higher orders by
+ * Terriberry), which avoids the cancellation of the textbook sum-of-squares formula.
+ * Two states are combined by the pairwise formulas of Chan and Pebay, such that
+ * the moments of disjoint row ranges can be merged.
+*/
+template <std::size_t MaxOrder>
+requires (MaxOrder >= 1 && MaxOrder <= 4)
+class CentralMoments {
+public:
+    void add (double value) {
+        const double count_before = static_cast<double>(count_);
+        count_ += 1;
+        const double count = static_cast<double>(count_);
+        const double delta = value - mean_;
+        const double delta_n = delta / count;
+        const double term = delta * delta_n * count_before;
+        mean_ += delta_n;
+        if constexpr (MaxOrder >= 4) {
+            m4_ += term * delta_n * delta_n * (count * count - 3 * count + 3) + 6 * delta_n * delta_n * m2_ - 4 * delta_n * m3_;
+        }
+        if constexpr (MaxOrder >= 3) {
+            m3_ += term * delta_n * (count - 2) - 3 * delta_n * m2_;
+        }
+        if constexpr (MaxOrder >= 2) {
+            m2_ += term;
+        }
+    }
+
+    /**
+     * Adds a range of values by their count and sum, which is sufficient for the mean only.
+    */
+    void addRange (std::size_t count, double sum) requires (MaxOrder == 1) {
+        if (count > 0) {
+            CentralMoments range{};
+            range.count_ = count;
+            range.mean_ = sum / static_cast<double>(count);
+            merge(range);
+        }
+    }
+
+    void merge (const CentralMoments& other) {
+        if (other.count_ == 0) {
+            return;
+        }
+        if (count_ == 0) {
+            *this = other;
+            return;
+        }
+        const double count_a = static_cast<double>(count_);
+        const double count_b = static_cast<double>(other.count_);
+        const double count = count_a + count_b;
+        const double delta = other.mean_ - mean_;
+        const double delta2 = delta * delta;
+        if constexpr (MaxOrder >= 4) {
+            m4_ += other.m4_
+                + delta2 * delta2 * count_a * count_b * (count_a * count_a - count_a * count_b + count_b * count_b) / (count * count * count)
+                + 6 * delta2 * (count_a * count_a * other.m2_ + count_b * count_b * m2_) / (count * count)
+                + 4 * delta * (count_a * other.m3_ - count_b * m3_) / count;
+        }
+        if constexpr (MaxOrder >= 3) {
+            m3_ += other.m3_
+                + delta2 * delta * count_a * count_b * (count_a - count_b) / (count * count)
+                + 3 * delta * (count_a * other.m2_ - count_b * m2_) / count;
+        }
+        if constexpr (MaxOrder >= 2) {
+            m2_ += other.m2_ + delta2 * count_a * count_b / count;
+        }
+        mean_ += delta * count_b / count;
+        count_ += other.count_;
+    }
+
+    std::size_t getCount () const {
+        return count_;
+    }
+
+    double getMean () const {
+        return mean_;
+    }
+
+    /**
+     * Returns the sum of squared deviations from the mean, M2 = sum((x - mean)^2).
+    */
+    double getM2 () const requires (MaxOrder >= 2) {
+        return m2_;
+    }
+
+    double getM3 () const requires (MaxOrder >= 3) {
+        return m3_;
+    }
+
+    double getM4 () const requires (MaxOrder >= 4) {
+        return m4_;
+    }
+
+private:
+    std::size_t count_ {0};
+    double mean_ {0};
+    [[no_unique_address]] std::conditional_t<(MaxOrder >= 2), double, UnusedState<2>> m2_ {};
+    [[no_unique_address]] std::conditional_t<(MaxOrder >= 3), double, UnusedState<3>> m3_ {};
+    [[no_unique_address]] std::conditional_t<(MaxOrder >= 4), double, UnusedState<4>> m4_ {};
+};
+
+enum class MomentStatistic {
+    Variance,
+    SampleVariance,
+    StdDev,
+    SampleStdDev,
+    Skewness,
+    Kurtosis,
+};
+
+constexpr std::size_t getMomentOrder (MomentStatistic statistic) {
+    switch (statistic) {
+        case MomentStatistic::Skewness:
+            return 3;
+        case MomentStatistic::Kurtosis:
+            return 4;
+        default:
+            return 2;
+    }
+}
+
+/**
+ * Derives a statistic from central moments. Statistics that are undefined for the number
+ * of values (e.g. the sample variance of a single value) are NaN.
+*/
+template <MomentStatistic Statistic, std::size_t MaxOrder>
+requires (getMomentOrder(Statistic) <= MaxOrder)
+double getMomentStatistic (const CentralMoments<MaxOrder>& moments) {
+    const double count = static_cast<double>(moments.getCount());
+    constexpr double NaN = std::numeric_limits<double>::quiet_NaN();
+    if constexpr (Statistic == MomentStatistic::Variance) {
+        return count > 0 ? moments.getM2() / count : NaN;
+    }
+    else if constexpr (Statistic == MomentStatistic::SampleVariance) {
+        return count > 1 ? moments.getM2() / (count - 1) : NaN;
+    }
+    else if constexpr (Statistic == MomentStatistic::StdDev) {
+        return count > 0 ? std::sqrt(moments.getM2() / count) : NaN;
+    }
+    else if constexpr (Statistic == MomentStatistic::SampleStdDev) {
+        return count > 1 ? std::sqrt(moments.getM2() / (count - 1)) : NaN;
+    }
+    else if constexpr (Statistic == MomentStatistic::Skewness) {
+        return count > 0 && moments.getM2() > 0 ? std::sqrt(count) * moments.getM3() / std::pow(moments.getM2(), 1.5) : NaN;
+    }
+    else {
+        return count > 0 && moments.getM2() > 0 ? count * moments.getM4() / (moments.getM2() * moments.getM2()) - 3 : NaN;
+    }
+}
+
+/**
+ * Summarizes a column by a statistic derived from its central moments.
+*/
+template <std::size_t InIndex, IsArithmetic T, MomentStatistic Statistic>
+class SummarizerMoments {
 public:
     using TargetType = double;
 
     template <typename DataIn>
     void summarize (const DataIn& in, std::size_t index) {
-        current_count_ += 1;
-        current_average_ = current_average_ + (static_cast<double>(std::get<InIndex>(in)[index]) - current_average_) / current_count_;
-        values_.push_back(std::get<InIndex>(in)[index]);
+        moments_.add(static_cast<double>(std::get<InIndex>(in)[index]));
+    }
+
+    void merge (const SummarizerMoments& other) {
+        moments_.merge(other.moments_);
     }
 
     double getState () const {
-        if (values_.size() > 0) {
-            double stddev {0};
-            for (auto value : values_) {
-                stddev += (value - current_average_)*(value - current_average_);
-            }
-            return std::sqrt(stddev / (values_.size()));
-        }
-        return std::numeric_limits<double>::quiet_NaN();
+        return getMomentStatistic<Statistic>(moments_);
     }
 
 private:
-    double current_average_ {0};
-    int current_count_ {0};
-    std::vector<T> values_{};
+    CentralMoments<getMomentOrder(Statistic)> moments_{};
 };
 
+template <std::size_t InIndex, IsArithmetic T>
+using SummarizerVariance = SummarizerMoments<InIndex, T, MomentStatistic::Variance>;
+
+template <std::size_t InIndex, IsArithmetic T>
+using SummarizerSampleVariance = SummarizerMoments<InIndex, T, MomentStatistic::SampleVariance>;
+
+template <std::size_t InIndex, IsArithmetic T>
+using SummarizerStdDev = SummarizerMoments<InIndex, T, MomentStatistic::StdDev>;
+
+template <std::size_t InIndex, IsArithmetic T>
+using SummarizerSampleStdDev = SummarizerMoments<InIndex, T, MomentStatistic::SampleStdDev>;
+
+template <std::size_t InIndex, IsArithmetic T>
+using SummarizerSkewness = SummarizerMoments<InIndex, T, MomentStatistic::Skewness>;
+
+template <std::size_t InIndex, IsArithmetic T>
+using SummarizerKurtosis = SummarizerMoments<InIndex, T, MomentStatistic::Kurtosis>;
+
 template <std::size_t InIndex, IsArithmetic T>
 class SummarizerMin {
 public:
@@ -182,6 +599,18 @@ public:
         }
     }
 
+    template <typename DataIn>
+    requires (not std::is_same_v<T, bool>)
+    void summarizeRange (const DataIn& in, std::size_t begin, std::size_t end) {
+        min_value_ = reduceMin(std::get<InIndex>(in).data() + begin, end - begin, min_value_);
+    }
+
+    void merge (const SummarizerMin& other) {
+        if (other.min_value_ < min_value_) {
+            min_value_ = other.min_value_;
+        }
+    }
+
     T getState() const {
         return min_value_;
     }
@@ -202,6 +631,18 @@ public:
         }
     }
 
+    template <typename DataIn>
+    requires (not std::is_same_v<T, bool>)
+    void summarizeRange (const DataIn& in, std::size_t begin, std::size_t end) {
+        max_value_ = reduceMax(std::get<InIndex>(in).data() + begin, end - begin, max_value_);
+    }
+
+    void merge (const SummarizerMax& other) {
+        if (other.max_value_ > max_value_) {
+            max_value_ = other.max_value_;
+        }
+    }
+
     T getState() const {
         return max_value_;
     }
@@ -223,6 +664,10 @@ public:
         }
     }
 
+    void merge (const SummarizerCountIf& other) {
+        count_ += other.count_;
+    }
+
     int getState() const {
         return count_;
     }
@@ -244,6 +689,10 @@ public:
         }
     }
 
+    void merge (const SummarizerCountIfNot& other) {
+        count_ += other.count_;
+    }
+
     int getState() const {
         return count_;
     }
@@ -252,6 +701,28 @@ private:
     int count_ {0};
 };
 
+template <std::size_t InIndex, IsHashable T, std::size_t Precision>
+class SummarizerCountDistinctApprox {
+public:
+    using TargetType = std::size_t;
+
+    template <typename DataIn>
+    void summarize (const DataIn& in, std::size_t index) {
+        sketch_.insert(mixHash(hashValue<T>(std::get<InIndex>(in)[index])));
+    }
+
+    void merge (const SummarizerCountDistinctApprox& other) {
+        sketch_.merge(other.sketch_);
+    }
+
+    std::size_t getState () const {
+        return static_cast<std::size_t>(std::llround(sketch_.getEstimate()));
+    }
+
+private:
+    HyperLogLog<Precision> sketch_{};
+};
+
 // ############################################################################
 // Trait: Is Valid Summarize Op
 // ############################################################################
@@ -260,90 +731,710 @@ template <typename ...>
 struct AreValidSummarizeOpsImpl : std::true_type {};
 
 template <template <FixedString, FixedString> typename Op, FixedString ColumnName, FixedString NewColumnName, typename ...RestOps, typename ...Columns>
+requires (not IsParameterizedSummarizeOp<Op<ColumnName, NewColumnName>>)
 struct AreValidSummarizeOpsImpl<TypeList<Op<ColumnName, NewColumnName>, RestOps...>, Columns...> {
     static constexpr bool value = are_names_in_columns<NameList<ColumnName>, Columns...> && AreValidSummarizeOpsImpl<TypeList<RestOps...>, Columns...>::value;
 };
 
+template <FixedString ColumnName, FixedString NewColumnName, std::size_t Precision, typename ...RestOps, typename ...Columns>
+struct AreValidSummarizeOpsImpl<TypeList<CountDistinctApprox<ColumnName, NewColumnName, Precision>, RestOps...>, Columns...> {
+    static constexpr bool value = are_names_in_columns<NameList<ColumnName>, Columns...> && AreValidSummarizeOpsImpl<TypeList<RestOps...>, Columns...>::value;
+};
+
+template <FixedString ColumnName, FixedString NewColumnName, std::size_t Percentile, typename ...RestOps, typename ...Columns>
+struct AreValidSummarizeOpsImpl<TypeList<Quantile<ColumnName, NewColumnName, Percentile>, RestOps...>, Columns...> {
+    static constexpr bool value = are_names_in_columns<NameList<ColumnName>, Columns...> && AreValidSummarizeOpsImpl<TypeList<RestOps...>, Columns...>::value;
+};
+
+template <FixedString ColumnName, FixedString NewColumnName, std::size_t Percentile, typename ...RestOps, typename ...Columns>
+struct AreValidSummarizeOpsImpl<TypeList<ExactQuantile<ColumnName, NewColumnName, Percentile>, RestOps...>, Columns...> {
+    static constexpr bool value = are_names_in_columns<NameList<ColumnName>, Columns...> && AreValidSummarizeOpsImpl<TypeList<RestOps...>, Columns...>::value;
+};
+
 template <typename Ops, typename ...Columns>
 constexpr bool are_valid_summarize_ops = AreValidSummarizeOpsImpl<Ops, Columns...>::value;
 
-// ############################################################################
-// Trait: Compound Summarizer
-// ############################################################################
-template <typename ...Summarizers>
-struct CompoundSummarizer {
-    static constexpr std::size_t NumSummarizers = sizeof...(Summarizers);
-    using Data = std::tuple<Summarizers...>;
-    
-    static auto create () {
-        return std::make_tuple(Summarizers{}...);
+template <std::size_t InIndex, IsArithmetic T, std::size_t Percentile>
+class SummarizerQuantile {
+public:
+    using TargetType = double;
+
+    template <typename DataIn>
+    void summarize (const DataIn& in, std::size_t index) {
+        digest_.insert(static_cast<double>(std::get<InIndex>(in)[index]));
     }
 
-    template <typename SummarizerData, typename ColumnStoreData>
-    static void summarize(SummarizerData& summarizer_data, const ColumnStoreData& column_store_data, std::size_t row_index) {
-        summarizeImpl(summarizer_data, column_store_data, row_index, std::index_sequence_for<Summarizers...>{});
+    void merge (const SummarizerQuantile& other) {
+        digest_.merge(other.digest_);
     }
 
-    template <typename SummarizerData, typename ColumnStoreData, std::size_t ...SummarizerIndices>
-    static void summarizeImpl(SummarizerData& summarizer_data, const ColumnStoreData& column_store_data, std::size_t row_index, std::integer_sequence<std::size_t, SummarizerIndices...>) {
-        ((std::get<SummarizerIndices>(summarizer_data).summarize(column_store_data, row_index)), ...);
+    double getState () const {
+        auto digest = digest_;
+        digest.compress();
+        return digest.getQuantile(static_cast<double>(Percentile) / 100.0);
     }
-};
 
-// ############################################################################
-// Trait: Prepend Compound Summarizer
-// ############################################################################
-template <typename, typename>
-struct CompoundSummarizerPrepend {};
+private:
+    static constexpr std::size_t COMPRESSION = 100;
 
-template <typename S, typename ...Rest>
-struct CompoundSummarizerPrepend<S, CompoundSummarizer<Rest...>> {
-    using type = CompoundSummarizer<S, Rest...>;
+    TDigest<COMPRESSION> digest_{};
 };
 
-// ############################################################################
-// Trait: Get Summarizer For Op
-// ############################################################################
-template <typename ...>
-struct GetSummarizerForOpImpl {};
+template <std::size_t InIndex, IsArithmetic T, std::size_t ...Percentiles>
+class SummarizerExactQuantile;
 
-template <FixedString ColumnName, FixedString NewColumnName, typename ...Columns>
-struct GetSummarizerForOpImpl<Min<ColumnName, NewColumnName>, Columns...> {
-    using type = SummarizerMin<get_column_index_by_name<ColumnName, Columns...>, GetColumnTypeByName<ColumnName, Columns...>>;
-};
+template <typename>
+struct IsExactQuantileSummarizerImpl : std::false_type {};
 
-template <FixedString ColumnName, FixedString NewColumnName, typename ...Columns>
-struct GetSummarizerForOpImpl<Max<ColumnName, NewColumnName>, Columns...> {
-    using type = SummarizerMax<get_column_index_by_name<ColumnName, Columns...>, GetColumnTypeByName<ColumnName, Columns...>>;
+template <std::size_t InIndex, typename T, std::size_t Percentile>
+struct IsExactQuantileSummarizerImpl<SummarizerExactQuantile<InIndex, T, Percentile>> : std::true_type {
+    static constexpr std::size_t in_index = InIndex;
+    static constexpr std::size_t percentile = Percentile;
 };
 
-template <FixedString ColumnName, FixedString NewColumnName, typename ...Columns>
-struct GetSummarizerForOpImpl<Sum<ColumnName, NewColumnName>, Columns...> {
-    using type = SummarizerSum<get_column_index_by_name<ColumnName, Columns...>, GetColumnTypeByName<ColumnName, Columns...>>;
-};
+/**
+ * Buffers all values of a group contiguously in the arena of the executer. All ExactQuantile ops
+ * on the same column share one summarizer with the percentiles of all ops, such that the values
+ * are buffered once. The ranks of all percentiles are selected in place by a single multi-selection
+ * on the first access to a result, which is cached until further values are added.
+ *
+ * The buffer of a group doubles its capacity when full. It grows in place if it is the most recent
+ * array of the arena, otherwise the previous buffer is abandoned until the arena is freed. Together
+ * with the geometric blocks of the arena, a group takes at most about four times the memory of its
+ * values. Groups merged from the executers of other row blocks copy their values, whereas the arenas
+ * of these executers are kept alive by the merged groups, which adds up to the memory of all values.
+*/
+template <std::size_t InIndex, IsArithmetic T, std::size_t ...Percentiles>
+class SummarizerExactQuantile {
+public:
+    using TargetType = double;
+    using Arena = ValueArena<T>;
 
-template <FixedString ColumnName, FixedString NewColumnName, typename ...Columns>
-struct GetSummarizerForOpImpl<Avg<ColumnName, NewColumnName>, Columns...> {
-    using type = SummarizerAvg<get_column_index_by_name<ColumnName, Columns...>, GetColumnTypeByName<ColumnName, Columns...>>;
-};
+    explicit SummarizerExactQuantile (Arena& arena)
+    : arena_{&arena}
+    {}
 
-template <FixedString ColumnName, FixedString NewColumnName, typename ...Columns>
-struct GetSummarizerForOpImpl<StdDev<ColumnName, NewColumnName>, Columns...> {
-    using type = SummarizerStdDev<get_column_index_by_name<ColumnName, Columns...>, GetColumnTypeByName<ColumnName, Columns...>>;
-};
+    template <typename DataIn>
+    void summarize (const DataIn& in, std::size_t index) {
+        if (size_ == capacity_) {
+            reserve(std::max(MIN_CAPACITY, 2 * capacity_));
+        }
+        values_[size_++] = std::get<InIndex>(in)[index];
+        is_selected_ = false;
+    }
 
-template <FixedString ColumnName, FixedString NewColumnName, typename ...Columns>
-struct GetSummarizerForOpImpl<CountIf<ColumnName, NewColumnName>, Columns...> {
-    using type = SummarizerCountIf<get_column_index_by_name<ColumnName, Columns...>, GetColumnTypeByName<ColumnName, Columns...>>;
-};
+    void merge (const SummarizerExactQuantile& other) {
+        if (size_ + other.size_ > capacity_) {
+            reserve(std::max(MIN_CAPACITY, size_ + other.size_));
+        }
+        std::copy(other.values_, other.values_ + other.size_, values_ + size_);
+        size_ += other.size_;
+        is_selected_ = false;
+    }
 
-template <FixedString ColumnName, FixedString NewColumnName, typename ...Columns>
-struct GetSummarizerForOpImpl<CountIfNot<ColumnName, NewColumnName>, Columns...> {
-    using type = SummarizerCountIfNot<get_column_index_by_name<ColumnName, Columns...>, GetColumnTypeByName<ColumnName, Columns...>>;
-};
+    double getState () const
+    requires (sizeof...(Percentiles) == 1) {
+        return getQuantile(0);
+    }
 
-template <typename Op, typename ...Columns>
-using GetSummarizerForOp = typename GetSummarizerForOpImpl<Op, Columns...>::type;
+    /**
+     * Result of the op of the summarizer SummarizerExactQuantile<InIndex, T, Percentile>.
+    */
+    template <typename Summarizer>
+    double getStateOf () const {
+        constexpr std::array<std::size_t, sizeof...(Percentiles)> percentiles{Percentiles...};
+        constexpr std::size_t index = std::find(percentiles.begin(), percentiles.end(), IsExactQuantileSummarizerImpl<Summarizer>::percentile) - percentiles.begin();
+        static_assert(index < sizeof...(Percentiles), "The percentile is not selected by the summarizer.");
+        return getQuantile(index);
+    }
+
+private:
+    static constexpr std::size_t MIN_CAPACITY = 4;
+    static constexpr std::size_t NUM_PERCENTILES = sizeof...(Percentiles);
+
+    static double getPosition (std::size_t size, std::size_t percentile) {
+        return static_cast<double>(size - 1) * static_cast<double>(percentile) / 100.0;
+    }
+
+    double getQuantile (std::size_t index) const {
+        if (size_ == 0) {
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+        if (not is_selected_) {
+            select();
+        }
+        return quantiles_[index];
+    }
+
+    /**
+     * Selects the lower and upper rank of each percentile by one multi-selection over the buffer,
+     * which only reorders the values of the group.
+    */
+    void select () const {
+        constexpr std::array<std::size_t, NUM_PERCENTILES> percentiles{Percentiles...};
+        std::array<std::size_t, 2 * NUM_PERCENTILES> ranks{};
+        std::size_t num_ranks {0};
+        for (auto percentile : percentiles) {
+            const auto lower_rank = static_cast<std::size_t>(getPosition(size_, percentile));
+            ranks[num_ranks++] = lower_rank;
+            if (lower_rank + 1 < size_) {
+                ranks[num_ranks++] = lower_rank + 1;
+            }
+        }
+        std::sort(ranks.begin(), ranks.begin() + num_ranks);
+        num_ranks = std::unique(ranks.begin(), ranks.begin() + num_ranks) - ranks.begin();
+        selectRanks(values_, values_ + size_, std::span<const std::size_t>{ranks.data(), num_ranks});
+
+        for (auto index = 0LU; index < NUM_PERCENTILES; ++index) {
+            const double position = getPosition(size_, percentiles[index]);
+            const auto lower_rank = static_cast<std::size_t>(position);
+            const double lower = static_cast<double>(values_[lower_rank]);
+            quantiles_[index] = lower_rank + 1 == size_
+                ? lower
+                : lower + (position - static_cast<double>(lower_rank)) * (static_cast<double>(values_[lower_rank + 1]) - lower);
+        }
+        is_selected_ = true;
+    }
+
+    void reserve (std::size_t capacity) {
+        if (values_ != nullptr && arena_->extend(values_, capacity_, capacity)) {
+            capacity_ = capacity;
+            return;
+        }
+        T* values = arena_->allocate(capacity);
+        std::copy(values_, values_ + size_, values);
+        values_ = values;
+        capacity_ = capacity;
+    }
+
+    Arena* arena_;
+    T* values_ {nullptr};
+    std::size_t size_ {0};
+    std::size_t capacity_ {0};
+    mutable std::array<double, NUM_PERCENTILES> quantiles_{};
+    mutable bool is_selected_ {false};
+};
+
+template <typename Summarizer>
+constexpr bool isExactQuantileOnColumn (std::size_t in_index) {
+    if constexpr (IsExactQuantileSummarizerImpl<Summarizer>::value) {
+        return IsExactQuantileSummarizerImpl<Summarizer>::in_index == in_index;
+    }
+    else {
+        return false;
+    }
+}
+
+/**
+ * Keeps the rows of the K largest (or smallest for ascending order) values in a bounded heap,
+ * whose top is the worst of the kept rows: a row replaces the top if it is better. Hence, n rows
+ * are summarized in O(n log K) with at most K rows per group. Equal values are ordered by the
+ * row index, such that the result is deterministic. NaN values are ignored.
+ *
+ * The state is the row indices ordered from best to worst.
+*/
+template <std::size_t InIndex, typename T, std::size_t K, SortOrder Order>
+requires (K > 0)
+class SummarizerTopK {
+public:
+    using TargetType = std::vector<std::size_t>;
+
+    template <typename DataIn>
+    void summarize (const DataIn& in, std::size_t index) {
+        const T& value = std::get<InIndex>(in)[index];
+        if constexpr (std::is_floating_point_v<T>) {
+            if (std::isnan(value)) {
+                return;
+            }
+        }
+        insert(Entry{value, index});
+    }
+
+    void merge (const SummarizerTopK& other) {
+        for (const auto& entry : other.heap_) {
+            insert(entry);
+        }
+    }
+
+    std::vector<std::size_t> getState () const {
+        auto entries = heap_;
+        std::sort(entries.begin(), entries.end(), &isBetter);
+        std::vector<std::size_t> row_indices(entries.size());
+        std::transform(entries.begin(), entries.end(), row_indices.begin(), [](const Entry& entry) {
+            return entry.row_index;
+        });
+        return row_indices;
+    }
+
+private:
+    struct Entry {
+        T value;
+        std::size_t row_index;
+    };
+
+    static bool isBetter (const Entry& lhs, const Entry& rhs) {
+        if constexpr (Order == SortOrder::Descending) {
+            return rhs.value < lhs.value || (not (lhs.value < rhs.value) && lhs.row_index < rhs.row_index);
+        }
+        else {
+            return lhs.value < rhs.value || (not (rhs.value < lhs.value) && lhs.row_index < rhs.row_index);
+        }
+    }
+
+    void insert (const Entry& entry) {
+        // with isBetter as less-than comparison, the heap top is the worst entry
+        if (heap_.size() < K) {
+            heap_.push_back(entry);
+            std::push_heap(heap_.begin(), heap_.end(), &isBetter);
+        }
+        else if (isBetter(entry, heap_.front())) {
+            std::pop_heap(heap_.begin(), heap_.end(), &isBetter);
+            heap_.back() = entry;
+            std::push_heap(heap_.begin(), heap_.end(), &isBetter);
+        }
+    }
+
+    std::vector<Entry> heap_{};
+};
+
+// ############################################################################
+// Class: Fused Summarizer
+// ############################################################################
+/**
+ * Statistics of a column kept by a fused summarizer. The moment order is 1 for the mean,
+ * 2 for the variance, 3 for the skewness and 4 for the kurtosis (0 for none).
+*/
+struct FusedFeatures {
+    bool sum {false};
+    bool min {false};
+    bool max {false};
+    std::size_t moment_order {0};
+
+    constexpr FusedFeatures operator| (const FusedFeatures& other) const {
+        return FusedFeatures{sum || other.sum, min || other.min, max || other.max, std::max(moment_order, other.moment_order)};
+    }
+};
+
+/**
+ * Trait of the summarizers that may be fused: the input column and the statistics they need.
+*/
+template <typename Summarizer>
+struct FusableSummarizerImpl : std::false_type {};
+
+template <std::size_t InIndex, typename T, FusedFeatures Features>
+struct FusableSummarizerInfo : std::true_type {
+    static constexpr std::size_t in_index = InIndex;
+    static constexpr FusedFeatures features = Features;
+    using Type = T;
+};
+
+template <std::size_t InIndex, typename T>
+struct FusableSummarizerImpl<SummarizerSum<InIndex, T>> : FusableSummarizerInfo<InIndex, T, FusedFeatures{.sum = true}> {};
+
+template <std::size_t InIndex, typename T>
+struct FusableSummarizerImpl<SummarizerMin<InIndex, T>> : FusableSummarizerInfo<InIndex, T, FusedFeatures{.min = true}> {};
+
+template <std::size_t InIndex, typename T>
+struct FusableSummarizerImpl<SummarizerMax<InIndex, T>> : FusableSummarizerInfo<InIndex, T, FusedFeatures{.max = true}> {};
+
+template <std::size_t InIndex, typename T>
+struct FusableSummarizerImpl<SummarizerAvg<InIndex, T>> : FusableSummarizerInfo<InIndex, T, FusedFeatures{.moment_order = 1}> {};
+
+template <std::size_t InIndex, typename T, MomentStatistic Statistic>
+struct FusableSummarizerImpl<SummarizerMoments<InIndex, T, Statistic>> : FusableSummarizerInfo<InIndex, T, FusedFeatures{.moment_order = getMomentOrder(Statistic)}> {
+    static constexpr MomentStatistic statistic = Statistic;
+};
+
+template <typename Summarizer>
+concept IsFusableSummarizer = FusableSummarizerImpl<Summarizer>::value;
+
+/**
+ * Returns the statistics needed by the summarizer if it reads the column in_index.
+*/
+template <typename Summarizer>
+constexpr FusedFeatures getFusedFeatures (std::size_t in_index) {
+    if constexpr (IsFusableSummarizer<Summarizer>) {
+        if (FusableSummarizerImpl<Summarizer>::in_index == in_index) {
+            return FusableSummarizerImpl<Summarizer>::features;
+        }
+    }
+    return FusedFeatures{};
+}
+
+template <typename Summarizer>
+constexpr bool isFusableOnColumn (std::size_t in_index) {
+    if constexpr (IsFusableSummarizer<Summarizer>) {
+        return FusableSummarizerImpl<Summarizer>::in_index == in_index;
+    }
+    else {
+        return false;
+    }
+}
+
+/**
+ * Summarizes a column by all statistics needed by the ops on the column in one accumulator:
+ * each value is read once, and the count and mean are shared by the average and the
+ * (higher-order) moments. Statistics not needed take no space.
+ *
+ * The result of an op is extracted by getStateOf<Summarizer>, with Summarizer being the
+ * summarizer the op would use if not fused.
+*/
+template <std::size_t InIndex, IsArithmetic T, FusedFeatures Features>
+class SummarizerFused {
+public:
+    template <typename DataIn>
+    void summarize (const DataIn& in, std::size_t index) {
+        const T value = std::get<InIndex>(in)[index];
+        if constexpr (Features.sum) {
+            sum_ += value;
+        }
+        if constexpr (Features.min) {
+            if (value < min_) {
+                min_ = value;
+            }
+        }
+        if constexpr (Features.max) {
+            if (value > max_) {
+                max_ = value;
+            }
+        }
+        if constexpr (Features.moment_order > 0) {
+            moments_.add(static_cast<double>(value));
+        }
+    }
+
+    template <typename DataIn>
+    requires (not std::is_same_v<T, bool>)
+    void summarizeRange (const DataIn& in, std::size_t begin, std::size_t end) {
+        const T* values = std::get<InIndex>(in).data() + begin;
+        if constexpr (Features.sum) {
+            sum_ += reduceSum<T>(values, end - begin);
+        }
+        if constexpr (Features.min) {
+            min_ = reduceMin(values, end - begin, min_);
+        }
+        if constexpr (Features.max) {
+            max_ = reduceMax(values, end - begin, max_);
+        }
+        if constexpr (Features.moment_order == 1) {
+            moments_.addRange(end - begin, reduceSum<double>(values, end - begin));
+        }
+        else if constexpr (Features.moment_order > 1) {
+            for (auto index = 0LU; index < end - begin; ++index) {
+                moments_.add(static_cast<double>(values[index]));
+            }
+        }
+    }
+
+    void merge (const SummarizerFused& other) {
+        if constexpr (Features.sum) {
+            sum_ += other.sum_;
+        }
+        if constexpr (Features.min) {
+            if (other.min_ < min_) {
+                min_ = other.min_;
+            }
+        }
+        if constexpr (Features.max) {
+            if (other.max_ > max_) {
+                max_ = other.max_;
+            }
+        }
+        if constexpr (Features.moment_order > 0) {
+            moments_.merge(other.moments_);
+        }
+    }
+
+    template <IsFusableSummarizer Summarizer>
+    typename Summarizer::TargetType getStateOf () const {
+        constexpr FusedFeatures features = FusableSummarizerImpl<Summarizer>::features;
+        if constexpr (features.sum) {
+            return sum_;
+        }
+        else if constexpr (features.min) {
+            return min_;
+        }
+        else if constexpr (features.max) {
+            return max_;
+        }
+        else if constexpr (features.moment_order == 1) {
+            return moments_.getMean();
+        }
+        else {
+            return getMomentStatistic<FusableSummarizerImpl<Summarizer>::statistic>(moments_);
+        }
+    }
+
+private:
+    static constexpr auto getInitialMin () {
+        if constexpr (Features.min) {
+            return std::numeric_limits<T>::max();
+        }
+        else {
+            return UnusedState<1>{};
+        }
+    }
+
+    static constexpr auto getInitialMax () {
+        if constexpr (Features.max) {
+            return std::numeric_limits<T>::lowest();
+        }
+        else {
+            return UnusedState<2>{};
+        }
+    }
+
+    [[no_unique_address]] std::conditional_t<Features.sum, T, UnusedState<0>> sum_ {};
+    [[no_unique_address]] std::conditional_t<Features.min, T, UnusedState<1>> min_ {getInitialMin()};
+    [[no_unique_address]] std::conditional_t<Features.max, T, UnusedState<2>> max_ {getInitialMax()};
+    [[no_unique_address]] std::conditional_t<(Features.moment_order > 0), CentralMoments<std::max(Features.moment_order, 1LU)>, UnusedState<3>> moments_ {};
+};
+
+// ############################################################################
+// Concept: Has Summarizer Arena
+// ############################################################################
+/**
+ * Summarizers with an arena allocate their buffers from an arena of the executer, which
+ * is passed on construction. The executer keeps the arena alive as long as the summarizers.
+*/
+template <typename Summarizer>
+concept HasSummarizerArena = requires {
+    typename Summarizer::Arena;
+} && std::constructible_from<Summarizer, typename Summarizer::Arena&>;
+
+struct NoSummarizerArena {};
+
+template <typename Summarizer>
+struct GetSummarizerArenaImpl {
+    using type = NoSummarizerArena;
+};
+
+template <HasSummarizerArena Summarizer>
+struct GetSummarizerArenaImpl<Summarizer> {
+    using type = typename Summarizer::Arena;
+};
+
+template <typename Summarizer>
+using GetSummarizerArena = typename GetSummarizerArenaImpl<Summarizer>::type;
+
+// ############################################################################
+// Concept: Has Summarize Range
+// ############################################################################
+/**
+ * Summarizers with summarizeRange reduce a whole range of rows by a column kernel,
+ * which is used if there is no group-by. Columns of bool have no contiguous storage
+ * (std::vector<bool>), such that their summarizers summarize row by row.
+*/
+template <typename Summarizer, typename ColumnStoreData>
+concept HasSummarizeRange = requires (Summarizer& summarizer, const ColumnStoreData& column_store_data, std::size_t begin, std::size_t end) {
+    summarizer.summarizeRange(column_store_data, begin, end);
+};
+
+// ############################################################################
+// Trait: Compound Summarizer
+// ############################################################################
+/**
+ * Summarizers of the ops, one result per summarizer.
+*/
+template <typename ...Summarizers>
+struct CompoundSummarizer {
+    static constexpr std::size_t NumSummarizers = sizeof...(Summarizers);
+    static constexpr std::size_t NumResults = NumSummarizers;
+    using Data = std::tuple<Summarizers...>;
+    using Arenas = std::tuple<GetSummarizerArena<Summarizers>...>;
+
+    static auto create (Arenas& arenas) {
+        return createImpl(arenas, std::index_sequence_for<Summarizers...>{});
+    }
+
+    template <std::size_t ...SummarizerIndices>
+    static auto createImpl (Arenas& arenas, std::integer_sequence<std::size_t, SummarizerIndices...>) {
+        return Data{createSummarizer<Summarizers>(std::get<SummarizerIndices>(arenas))...};
+    }
+
+    template <typename Summarizer, typename Arena>
+    static Summarizer createSummarizer (Arena& arena) {
+        if constexpr (HasSummarizerArena<Summarizer>) {
+            return Summarizer{arena};
+        }
+        else {
+            return Summarizer{};
+        }
+    }
+
+    template <typename SummarizerData, typename ColumnStoreData>
+    static void summarize(SummarizerData& summarizer_data, const ColumnStoreData& column_store_data, std::size_t row_index) {
+        summarizeImpl(summarizer_data, column_store_data, row_index, std::index_sequence_for<Summarizers...>{});
+    }
+
+    template <typename SummarizerData, typename ColumnStoreData, std::size_t ...SummarizerIndices>
+    static void summarizeImpl(SummarizerData& summarizer_data, const ColumnStoreData& column_store_data, std::size_t row_index, std::integer_sequence<std::size_t, SummarizerIndices...>) {
+        ((std::get<SummarizerIndices>(summarizer_data).summarize(column_store_data, row_index)), ...);
+    }
+
+    /**
+     * Summarizes the rows [begin, end) column-at-a-time: one summarizer after the other.
+    */
+    template <typename SummarizerData, typename ColumnStoreData>
+    static void summarizeRange(SummarizerData& summarizer_data, const ColumnStoreData& column_store_data, std::size_t begin, std::size_t end) {
+        summarizeRangeImpl(summarizer_data, column_store_data, begin, end, std::index_sequence_for<Summarizers...>{});
+    }
+
+    template <typename SummarizerData, typename ColumnStoreData, std::size_t ...SummarizerIndices>
+    static void summarizeRangeImpl(SummarizerData& summarizer_data, const ColumnStoreData& column_store_data, std::size_t begin, std::size_t end, std::integer_sequence<std::size_t, SummarizerIndices...>) {
+        ((summarizeRangeBy(std::get<SummarizerIndices>(summarizer_data), column_store_data, begin, end)), ...);
+    }
+
+    template <typename Summarizer, typename ColumnStoreData>
+    static void summarizeRangeBy(Summarizer& summarizer, const ColumnStoreData& column_store_data, std::size_t begin, std::size_t end) {
+        if constexpr (HasSummarizeRange<Summarizer, ColumnStoreData>) {
+            summarizer.summarizeRange(column_store_data, begin, end);
+        }
+        else {
+            for (auto row_index = begin; row_index < end; ++row_index) {
+                summarizer.summarize(column_store_data, row_index);
+            }
+        }
+    }
+
+    template <typename SummarizerData>
+    static void merge(SummarizerData& summarizer_data, const SummarizerData& other_summarizer_data) {
+        mergeImpl(summarizer_data, other_summarizer_data, std::index_sequence_for<Summarizers...>{});
+    }
+
+    template <typename SummarizerData, std::size_t ...SummarizerIndices>
+    static void mergeImpl(SummarizerData& summarizer_data, const SummarizerData& other_summarizer_data, std::integer_sequence<std::size_t, SummarizerIndices...>) {
+        ((std::get<SummarizerIndices>(summarizer_data).merge(std::get<SummarizerIndices>(other_summarizer_data))), ...);
+    }
+
+    template <std::size_t ResultIndex, typename SummarizerData>
+    static auto getResult(const SummarizerData& summarizer_data) {
+        return std::get<ResultIndex>(summarizer_data).getState();
+    }
+};
+
+/**
+ * Result of an op taken from the summarizer at SlotIndex, which is either the summarizer of
+ * the op itself or a fused summarizer.
+*/
+template <std::size_t SlotIndex, typename Summarizer>
+struct SummarizerResult {
+    template <typename SummarizerData>
+    static auto get (const SummarizerData& summarizer_data) {
+        if constexpr (std::is_same_v<std::tuple_element_t<SlotIndex, SummarizerData>, Summarizer>) {
+            return std::get<SlotIndex>(summarizer_data).getState();
+        }
+        else {
+            return std::get<SlotIndex>(summarizer_data).template getStateOf<Summarizer>();
+        }
+    }
+};
+
+/**
+ * Summarizers of the ops with fused summarizers shared by several ops: the results are
+ * mapped to the summarizers by SummarizerResult.
+*/
+template <typename, typename>
+struct FusedCompoundSummarizer {};
+
+template <typename ...Results, typename ...Summarizers>
+struct FusedCompoundSummarizer<TypeList<Results...>, TypeList<Summarizers...>> : CompoundSummarizer<Summarizers...> {
+    static constexpr std::size_t NumResults = sizeof...(Results);
+
+    template <std::size_t ResultIndex, typename SummarizerData>
+    static auto getResult(const SummarizerData& summarizer_data) {
+        return std::tuple_element_t<ResultIndex, std::tuple<Results...>>::get(summarizer_data);
+    }
+};
+
+// ############################################################################
+// Trait: Get Summarizer For Op
+// ############################################################################
+template <typename ...>
+struct GetSummarizerForOpImpl {};
+
+template <FixedString ColumnName, FixedString NewColumnName, typename ...Columns>
+struct GetSummarizerForOpImpl<Min<ColumnName, NewColumnName>, Columns...> {
+    using type = SummarizerMin<get_column_index_by_name<ColumnName, Columns...>, GetColumnTypeByName<ColumnName, Columns...>>;
+};
+
+template <FixedString ColumnName, FixedString NewColumnName, typename ...Columns>
+struct GetSummarizerForOpImpl<Max<ColumnName, NewColumnName>, Columns...> {
+    using type = SummarizerMax<get_column_index_by_name<ColumnName, Columns...>, GetColumnTypeByName<ColumnName, Columns...>>;
+};
+
+template <FixedString ColumnName, FixedString NewColumnName, typename ...Columns>
+struct GetSummarizerForOpImpl<Sum<ColumnName, NewColumnName>, Columns...> {
+    using type = SummarizerSum<get_column_index_by_name<ColumnName, Columns...>, GetColumnTypeByName<ColumnName, Columns...>>;
+};
+
+template <FixedString ColumnName, FixedString NewColumnName, typename ...Columns>
+struct GetSummarizerForOpImpl<Avg<ColumnName, NewColumnName>, Columns...> {
+    using type = SummarizerAvg<get_column_index_by_name<ColumnName, Columns...>, GetColumnTypeByName<ColumnName, Columns...>>;
+};
+
+template <FixedString ColumnName, FixedString NewColumnName, typename ...Columns>
+struct GetSummarizerForOpImpl<StdDev<ColumnName, NewColumnName>, Columns...> {
+    using type = SummarizerStdDev<get_column_index_by_name<ColumnName, Columns...>, GetColumnTypeByName<ColumnName, Columns...>>;
+};
+template <FixedString ColumnName, FixedString NewColumnName, typename ...Columns>
+struct GetSummarizerForOpImpl<SampleStdDev<ColumnName, NewColumnName>, Columns...> {
+    using type = SummarizerSampleStdDev<get_column_index_by_name<ColumnName, Columns...>, GetColumnTypeByName<ColumnName, Columns...>>;
+};
+template <FixedString ColumnName, FixedString NewColumnName, typename ...Columns>
+struct GetSummarizerForOpImpl<Variance<ColumnName, NewColumnName>, Columns...> {
+    using type = SummarizerVariance<get_column_index_by_name<ColumnName, Columns...>, GetColumnTypeByName<ColumnName, Columns...>>;
+};
+template <FixedString ColumnName, FixedString NewColumnName, typename ...Columns>
+struct GetSummarizerForOpImpl<SampleVariance<ColumnName, NewColumnName>, Columns...> {
+    using type = SummarizerSampleVariance<get_column_index_by_name<ColumnName, Columns...>, GetColumnTypeByName<ColumnName, Columns...>>;
+};
+template <FixedString ColumnName, FixedString NewColumnName, typename ...Columns>
+struct GetSummarizerForOpImpl<Skewness<ColumnName, NewColumnName>, Columns...> {
+    using type = SummarizerSkewness<get_column_index_by_name<ColumnName, Columns...>, GetColumnTypeByName<ColumnName, Columns...>>;
+};
+template <FixedString ColumnName, FixedString NewColumnName, typename ...Columns>
+struct GetSummarizerForOpImpl<Kurtosis<ColumnName, NewColumnName>, Columns...> {
+    using type = SummarizerKurtosis<get_column_index_by_name<ColumnName, Columns...>, GetColumnTypeByName<ColumnName, Columns...>>;
+};
+
+template <FixedString ColumnName, FixedString NewColumnName, typename ...Columns>
+struct GetSummarizerForOpImpl<CountIf<ColumnName, NewColumnName>, Columns...> {
+    using type = SummarizerCountIf<get_column_index_by_name<ColumnName, Columns...>, GetColumnTypeByName<ColumnName, Columns...>>;
+};
+
+template <FixedString ColumnName, FixedString NewColumnName, typename ...Columns>
+struct GetSummarizerForOpImpl<CountIfNot<ColumnName, NewColumnName>, Columns...> {
+    using type = SummarizerCountIfNot<get_column_index_by_name<ColumnName, Columns...>, GetColumnTypeByName<ColumnName, Columns...>>;
+};
+
+template <FixedString ColumnName, FixedString NewColumnName, std::size_t Precision, typename ...Columns>
+struct GetSummarizerForOpImpl<CountDistinctApprox<ColumnName, NewColumnName, Precision>, Columns...> {
+    using type = SummarizerCountDistinctApprox<get_column_index_by_name<ColumnName, Columns...>, GetColumnTypeByName<ColumnName, Columns...>, Precision>;
+};
+
+template <FixedString ColumnName, FixedString NewColumnName, std::size_t Percentile, typename ...Columns>
+struct GetSummarizerForOpImpl<Quantile<ColumnName, NewColumnName, Percentile>, Columns...> {
+    using type = SummarizerQuantile<get_column_index_by_name<ColumnName, Columns...>, GetColumnTypeByName<ColumnName, Columns...>, Percentile>;
+};
+
+template <FixedString ColumnName, FixedString NewColumnName, typename ...Columns>
+struct GetSummarizerForOpImpl<Median<ColumnName, NewColumnName>, Columns...> {
+    using type = SummarizerQuantile<get_column_index_by_name<ColumnName, Columns...>, GetColumnTypeByName<ColumnName, Columns...>, 50>;
+};
+
+template <FixedString ColumnName, FixedString NewColumnName, std::size_t Percentile, typename ...Columns>
+struct GetSummarizerForOpImpl<ExactQuantile<ColumnName, NewColumnName, Percentile>, Columns...> {
+    using type = SummarizerExactQuantile<get_column_index_by_name<ColumnName, Columns...>, GetColumnTypeByName<ColumnName, Columns...>, Percentile>;
+};
+
+template <FixedString ColumnName, FixedString NewColumnName, typename ...Columns>
+struct GetSummarizerForOpImpl<ExactMedian<ColumnName, NewColumnName>, Columns...> {
+    using type = SummarizerExactQuantile<get_column_index_by_name<ColumnName, Columns...>, GetColumnTypeByName<ColumnName, Columns...>, 50>;
+};
+
+template <typename Op, typename ...Columns>
+using GetSummarizerForOp = typename GetSummarizerForOpImpl<Op, Columns...>::type;
 
 // ############################################################################
 // Trait: GetColumnForOp
@@ -352,10 +1443,26 @@ template <typename, typename ...>
 struct GetColumnForOpImpl {};
 
 template <template <FixedString, FixedString> typename Op, FixedString ColumnName, FixedString NewColumnName, typename ...Columns>
+requires (not IsParameterizedSummarizeOp<Op<ColumnName, NewColumnName>>)
 struct GetColumnForOpImpl<Op<ColumnName, NewColumnName>, Columns...> {
     using type = Column<NewColumnName, typename GetSummarizerForOp<Op<ColumnName, NewColumnName>, Columns...>::TargetType>;
 };
 
+template <FixedString ColumnName, FixedString NewColumnName, std::size_t Precision, typename ...Columns>
+struct GetColumnForOpImpl<CountDistinctApprox<ColumnName, NewColumnName, Precision>, Columns...> {
+    using type = Column<NewColumnName, typename GetSummarizerForOp<CountDistinctApprox<ColumnName, NewColumnName, Precision>, Columns...>::TargetType>;
+};
+
+template <FixedString ColumnName, FixedString NewColumnName, std::size_t Percentile, typename ...Columns>
+struct GetColumnForOpImpl<Quantile<ColumnName, NewColumnName, Percentile>, Columns...> {
+    using type = Column<NewColumnName, typename GetSummarizerForOp<Quantile<ColumnName, NewColumnName, Percentile>, Columns...>::TargetType>;
+};
+
+template <FixedString ColumnName, FixedString NewColumnName, std::size_t Percentile, typename ...Columns>
+struct GetColumnForOpImpl<ExactQuantile<ColumnName, NewColumnName, Percentile>, Columns...> {
+    using type = Column<NewColumnName, typename GetSummarizerForOp<ExactQuantile<ColumnName, NewColumnName, Percentile>, Columns...>::TargetType>;
+};
+
 template <typename Op, typename ...Columns>
 using GetColumnForOp = typename GetColumnForOpImpl<Op, Columns...>::type;
 
@@ -383,22 +1490,94 @@ using GetNewColumnsForOps = typename GetNewColumnsForOpsImpl<Ops, Columns...>::t
 // ############################################################################
 // Trait: Get Compound Summarizer
 // ############################################################################
-template <typename, typename ...>
-struct GetCompoundSummarizerImpl {
-    using type = CompoundSummarizer<>;
+/**
+ * Summarizer used for a summarizer of an op: if at least two summarizers of the ops read the
+ * same column and may be fused, they are replaced by a fused summarizer for the column.
+*/
+template <typename Summarizer, typename AllSummarizers>
+struct GetSlotSummarizerImpl {
+    using type = Summarizer;
 };
 
-template <typename FirstOp, typename ...RestOps, typename ...Columns>
-struct GetCompoundSummarizerImpl<TypeList<FirstOp, RestOps...>, Columns...> {
-    using type = typename CompoundSummarizerPrepend<
-        GetSummarizerForOp<FirstOp, Columns...>,
-        typename GetCompoundSummarizerImpl<TypeList<RestOps...>, Columns...>::type
-    >::type;
+template <IsFusableSummarizer Summarizer, typename ...AllSummarizers>
+requires ((static_cast<std::size_t>(isFusableOnColumn<AllSummarizers>(FusableSummarizerImpl<Summarizer>::in_index)) + ...) >= 2)
+struct GetSlotSummarizerImpl<Summarizer, TypeList<AllSummarizers...>> {
+    static constexpr std::size_t InIndex = FusableSummarizerImpl<Summarizer>::in_index;
+    using type = SummarizerFused<
+        InIndex,
+        typename FusableSummarizerImpl<Summarizer>::Type,
+        (getFusedFeatures<AllSummarizers>(InIndex) | ...)
+    >;
+};
+
+template <typename Slot, typename Summarizers>
+struct AppendExactQuantilesImpl {
+    using type = Slot;
+};
+
+template <std::size_t InIndex, typename T, std::size_t ...Percentiles, std::size_t Percentile, typename ...RestSummarizers>
+struct AppendExactQuantilesImpl<SummarizerExactQuantile<InIndex, T, Percentiles...>, TypeList<SummarizerExactQuantile<InIndex, T, Percentile>, RestSummarizers...>> {
+    using type = typename AppendExactQuantilesImpl<SummarizerExactQuantile<InIndex, T, Percentiles..., Percentile>, TypeList<RestSummarizers...>>::type;
+};
+
+template <typename Slot, typename FirstSummarizer, typename ...RestSummarizers>
+struct AppendExactQuantilesImpl<Slot, TypeList<FirstSummarizer, RestSummarizers...>> {
+    using type = typename AppendExactQuantilesImpl<Slot, TypeList<RestSummarizers...>>::type;
+};
+
+/**
+ * ExactQuantile summarizers on the same column share one summarizer with all percentiles.
+*/
+template <std::size_t InIndex, typename T, std::size_t Percentile, typename ...AllSummarizers>
+requires ((static_cast<std::size_t>(isExactQuantileOnColumn<AllSummarizers>(InIndex)) + ...) >= 2)
+struct GetSlotSummarizerImpl<SummarizerExactQuantile<InIndex, T, Percentile>, TypeList<AllSummarizers...>> {
+    using type = typename AppendExactQuantilesImpl<SummarizerExactQuantile<InIndex, T>, TypeList<AllSummarizers...>>::type;
+};
+
+template <typename Summarizer, typename AllSummarizers>
+using GetSlotSummarizer = typename GetSlotSummarizerImpl<Summarizer, AllSummarizers>::type;
+
+template <typename, typename ...>
+struct GetCompoundSummarizerImpl {};
+
+/**
+ * Compound summarizer of the ops. Ops reading the same column share a fused summarizer,
+ * if possible, such that the column is read once and common state (e.g. count and mean)
+ * is computed once.
+*/
+template <typename ...Ops, typename ...Columns>
+struct GetCompoundSummarizerImpl<TypeList<Ops...>, Columns...> {
+    using Summarizers = TypeList<GetSummarizerForOp<Ops, Columns...>...>;
+    using Slots = TypeListUnique<TypeList<GetSlotSummarizer<GetSummarizerForOp<Ops, Columns...>, Summarizers>...>>;
+
+    using type = std::conditional_t<
+        std::is_same_v<Summarizers, Slots>,
+        typename Summarizers::template To<CompoundSummarizer>,
+        FusedCompoundSummarizer<
+            TypeList<SummarizerResult<type_list_index<GetSlotSummarizer<GetSummarizerForOp<Ops, Columns...>, Summarizers>, Slots>, GetSummarizerForOp<Ops, Columns...>>...>,
+            Slots
+        >
+    >;
 };
 
 template <typename Ops, typename ...Columns>
 using GetCompoundSummarizer = typename GetCompoundSummarizerImpl<Ops, Columns...>::type;
 
+// ############################################################################
+// Function: Append To Column
+// ############################################################################
+/**
+ * Appends the values get_value(0), ..., get_value(num_values - 1) to a column of a result with
+ * the capacity reserved once.
+*/
+template <typename ColumnData, typename GetValue>
+void appendToColumn (ColumnData& column_data, std::size_t num_values, GetValue&& get_value) {
+    column_data.reserve(column_data.size() + num_values);
+    for (auto index = 0LU; index < num_values; ++index) {
+        column_data.push_back(get_value(index));
+    }
+}
+
 // ############################################################################
 // Class: SummarizationExecuter
 // ############################################################################
@@ -407,7 +1586,7 @@ class SummarizationExecuterNoGroupBy {
 public:
     SummarizationExecuterNoGroupBy () {
         summarizer_data_.push_back(
-            CompoundSummarizer::create()
+            CompoundSummarizer::create(*arenas_)
         );
     }
 
@@ -416,83 +1595,392 @@ public:
         CompoundSummarizer::summarize(summarizer_data_[0], column_store_data, row_index);
     }
 
-    auto constructResult () {
-        using SummarizerIndices = std::make_index_sequence<CompoundSummarizer::NumSummarizers>;
-        return constructResultImpl(SummarizerIndices{});
+    template <typename ColumnStoreData>
+    void summarizeRange (const ColumnStoreData& column_store_data, std::size_t begin, std::size_t end) {
+        CompoundSummarizer::summarizeRange(summarizer_data_[0], column_store_data, begin, end);
+    }
+
+    void merge (const SummarizationExecuterNoGroupBy& other) {
+        CompoundSummarizer::merge(summarizer_data_[0], other.summarizer_data_[0]);
     }
 
-    template <std::size_t ...SummarizerIndices>
-    auto constructResultImpl (std::integer_sequence<std::size_t, SummarizerIndices...>) {
+    const std::vector<typename CompoundSummarizer::Data>& getSummarizerData () const {
+        return summarizer_data_;
+    }
+
+    auto constructResult () const {
+        using ResultIndices = std::make_index_sequence<CompoundSummarizer::NumResults>;
+        return constructResultImpl(ResultIndices{});
+    }
+
+    template <std::size_t ...ResultIndices>
+    auto constructResultImpl (std::integer_sequence<std::size_t, ResultIndices...>) const {
         NewDataFrame result;
         for (auto loop_index = 0LU; loop_index < summarizer_data_.size(); ++loop_index) {
             result.insert(
-                std::get<SummarizerIndices>(summarizer_data_[loop_index]).getState()...
+                CompoundSummarizer::template getResult<ResultIndices>(summarizer_data_[loop_index])...
             );
         }
         return result;
     }
 
 private:
+    // the arenas are allocated separately, such that their address is stable when moving the executer
+    std::unique_ptr<typename CompoundSummarizer::Arenas> arenas_ {std::make_unique<typename CompoundSummarizer::Arenas>()};
     std::vector<typename CompoundSummarizer::Data> summarizer_data_{};
 };
 
-template <typename NewDataFrame, typename GroupByColumnIndices, typename GroupByTypes, typename CompoundSummarizer>
+/**
+ * Groups are stored in the order of their first appearance, such that the result is deterministic.
+ *
+ * For the Hash strategy and hashable group-by types, the group of a row is found by an open-addressing
+ * hash table (linear probing) over the combined hash of all group-by columns, which maps to the index
+ * of the group. Otherwise, all groups are searched linearly.
+ *
+ * For the SortedRuns strategy, a row is only compared with the last group: each run of equal
+ * group-by values starts a new group without any lookup structure. For group-by types with operator<,
+ * the runs must be strictly ascending or descending, otherwise a SummarizeException is thrown.
+ *
+ * With a KeyDomain (single group-by column with a small domain of values), the group is looked up
+ * in a flat array indexed by the value, without hashing or comparisons. It requires the Hash strategy.
+*/
+template <typename NewDataFrame, typename GroupByColumnIndices, typename GroupByTypes, typename CompoundSummarizer, SummarizeStrategy Strategy = SummarizeStrategy::Hash, typename Domain = NoKeyDomain>
 class SummarizationExecuterGroupBy {
+    static_assert(std::is_same_v<Domain, NoKeyDomain> || Strategy == SummarizeStrategy::Hash, "A key domain requires the Hash strategy.");
+
 public:
+    // number of values of the key domain, 0 without a key domain
+    static constexpr std::size_t KEY_DOMAIN_SIZE = Domain::SIZE;
+
     template <typename ColumnStoreData>
-        void summarize(const ColumnStoreData& column_store_data, std::size_t row_index) {
-            auto index = getGroupByIndex(column_store_data, row_index, GroupByDataIndices{}, GroupByColumnIndices{});
-            if (index == -1) {
-                createNewGroupByEntry(column_store_data, row_index, GroupByColumnIndices{});;
-                index = group_by_data_.size() - 1;
-            }
-            CompoundSummarizer::summarize(summarizer_data_[index], column_store_data, row_index);
+    void summarize (const ColumnStoreData& column_store_data, std::size_t row_index) {
+        const auto index = getOrCreateGroupIndex(column_store_data, row_index);
+        CompoundSummarizer::summarize(summarizer_data_[index], column_store_data, row_index);
+    }
+
+    template <typename ColumnStoreData>
+    std::size_t getOrCreateGroupIndex (const ColumnStoreData& column_store_data, std::size_t row_index) {
+        std::uint64_t hash {0};
+        if constexpr (USE_KEY_DOMAIN) {
+            hash = getDomainSlot(std::get<0>(getRowKey(column_store_data, row_index, GroupByColumnIndices{})));
+        }
+        else if constexpr (USE_HASH_TABLE) {
+            hash = hashColumnStoreRow(column_store_data, row_index, GroupByColumnIndices{});
         }
+        return findOrCreateGroup(
+            hash,
+            [&](std::size_t index) {
+                return isGroupOfRow(index, column_store_data, row_index, GroupByDataIndices{}, GroupByColumnIndices{});
+            },
+            [&]() {
+                if constexpr (USE_SORTED_RUNS) {
+                    checkRunOrder(getRowKey(column_store_data, row_index, GroupByColumnIndices{}));
+                }
+                createNewGroupByEntry(column_store_data, row_index, GroupByColumnIndices{});
+            }
+        );
+    }
 
-        template <typename ColumnStoreData, std::size_t ... GroupByColumnIndicesInColumnStore>
-        void createNewGroupByEntry (const ColumnStoreData& column_store_data, std::size_t row_index, std::integer_sequence<std::size_t, GroupByColumnIndicesInColumnStore...>) {
-            group_by_data_.push_back(
-                std::make_tuple(std::get<GroupByColumnIndicesInColumnStore>(column_store_data)[row_index]...)
+    /**
+     * Merges the groups of another executer into this one. Groups not yet available are appended
+     * in the order of the other executer, such that merging executers of consecutive row ranges
+     * in order yields the same group order as summarizing all rows by a single executer.
+    */
+    void merge (SummarizationExecuterGroupBy&& other) {
+        // groups moved from the other executer still refer to its arenas
+        merged_arenas_.push_back(std::move(other.arenas_));
+        std::move(other.merged_arenas_.begin(), other.merged_arenas_.end(), std::back_inserter(merged_arenas_));
+        if constexpr (USE_SORTED_RUNS) {
+            if (not group_by_data_.empty() && not other.group_by_data_.empty() && group_by_data_.back() != other.group_by_data_.front()) {
+                checkRunOrder(other.group_by_data_.front());
+            }
+            if (other.run_direction_ != 0 && run_direction_ != 0 && other.run_direction_ != run_direction_) {
+                throw SummarizeException{"Runs of the group-by columns are neither ascending nor descending."};
+            }
+            run_direction_ = run_direction_ != 0 ? run_direction_ : other.run_direction_;
+        }
+        for (auto other_index = 0LU; other_index < other.group_by_data_.size(); ++other_index) {
+            bool is_new_group {false};
+            const auto index = findOrCreateGroup(
+                getMergeHash(other, other_index),
+                [&](std::size_t index) {
+                    return group_by_data_[index] == other.group_by_data_[other_index];
+                },
+                [&]() {
+                    group_by_data_.push_back(std::move(other.group_by_data_[other_index]));
+                    summarizer_data_.push_back(std::move(other.summarizer_data_[other_index]));
+                    is_new_group = true;
+                }
             );
-            summarizer_data_.push_back(CompoundSummarizer::create());
+            if (not is_new_group) {
+                CompoundSummarizer::merge(summarizer_data_[index], other.summarizer_data_[other_index]);
+            }
         }
+    }
+
+    /**
+     * Merges summarizer states into the group of a row, e.g. to derive the groups of a coarser
+     * group-by from the groups of a finer one.
+    */
+    template <typename ColumnStoreData>
+    void mergeIntoGroup (const ColumnStoreData& column_store_data, std::size_t row_index, const typename CompoundSummarizer::Data& summarizer_data) {
+        const auto index = getOrCreateGroupIndex(column_store_data, row_index);
+        CompoundSummarizer::merge(summarizer_data_[index], summarizer_data);
+    }
+
+    std::size_t getNumGroups () const {
+        return group_by_data_.size();
+    }
+
+    /**
+     * Group-by values and summarizer states of the groups in the order of the groups.
+    */
+    const std::vector<GroupByTypes>& getGroupByData () const {
+        return group_by_data_;
+    }
 
-        template <typename ColumnStoreData, std::size_t ...GroupByDataIndices, std::size_t ...GroupByColumnIndicesInColumnStore>
-        int getGroupByIndex(const ColumnStoreData& column_store_data, std::size_t row_index, std::integer_sequence<std::size_t, GroupByDataIndices...>, std::integer_sequence<std::size_t, GroupByColumnIndicesInColumnStore...>) {
-            for (std::size_t loop_index = 0; loop_index < group_by_data_.size(); ++loop_index) {
-                if (((std::get<GroupByDataIndices>(group_by_data_[loop_index]) == std::get<GroupByColumnIndicesInColumnStore>(column_store_data)[row_index]) && ...)) {
-                    return loop_index;
+    const std::vector<typename CompoundSummarizer::Data>& getSummarizerData () const {
+        return summarizer_data_;
+    }
+
+    /**
+     * Constructs the result column by column, with the capacity of each column reserved once for
+     * the number of groups. The group-by values are moved into the result for an rvalue executer.
+    */
+    auto constructResult () const & {
+        return constructResultImpl(group_by_data_, summarizer_data_, GroupByDataIndices{}, ResultIndices{});
+    }
+
+    auto constructResult () && {
+        return constructResultImpl(group_by_data_, summarizer_data_, GroupByDataIndices{}, ResultIndices{});
+    }
+
+private:
+    using GroupByDataIndices = std::make_index_sequence<get_integer_sequence_size<GroupByColumnIndices>>;
+    using ResultIndices = std::make_index_sequence<CompoundSummarizer::NumResults>;
+
+    static constexpr bool USE_KEY_DOMAIN = not std::is_same_v<Domain, NoKeyDomain>;
+    static constexpr bool USE_SORTED_RUNS = not USE_KEY_DOMAIN && Strategy == SummarizeStrategy::SortedRuns;
+    static constexpr bool USE_HASH_TABLE = not USE_KEY_DOMAIN && Strategy == SummarizeStrategy::Hash && are_types_hashable<GroupByTypes>;
+    static constexpr std::size_t EMPTY_SLOT = std::numeric_limits<std::size_t>::max();
+    static constexpr std::uint32_t EMPTY_DOMAIN_SLOT = std::numeric_limits<std::uint32_t>::max();
+    static constexpr std::size_t MIN_NUM_SLOTS = 16;
+
+    template <typename IsGroup, typename CreateGroup>
+    std::size_t findOrCreateGroup (std::uint64_t hash, IsGroup&& is_group, CreateGroup&& create_group) {
+        if constexpr (USE_KEY_DOMAIN) {
+            if (domain_slots_.empty()) {
+                domain_slots_.assign(Domain::SIZE, EMPTY_DOMAIN_SLOT);
+            }
+            if (domain_slots_[hash] != EMPTY_DOMAIN_SLOT) {
+                return domain_slots_[hash];
+            }
+            // the number of groups is bounded by the domain size of at most 2^24
+            domain_slots_[hash] = static_cast<std::uint32_t>(group_by_data_.size());
+        }
+        else if constexpr (USE_SORTED_RUNS) {
+            if (not group_by_data_.empty() && is_group(group_by_data_.size() - 1)) {
+                return group_by_data_.size() - 1;
+            }
+        }
+        else if constexpr (USE_HASH_TABLE) {
+            if (2 * (group_by_data_.size() + 1) > slots_.size()) {
+                resizeSlots(std::max(MIN_NUM_SLOTS, 2 * slots_.size()));
+            }
+            auto slot = hash & (slots_.size() - 1);
+            for (; slots_[slot] != EMPTY_SLOT; slot = (slot + 1) & (slots_.size() - 1)) {
+                const auto index = slots_[slot];
+                if (group_hashes_[index] == hash && is_group(index)) {
+                    return index;
                 }
             }
-            return -1;
+            slots_[slot] = group_by_data_.size();
+            group_hashes_.push_back(hash);
         }
+        else {
+            for (auto index = 0LU; index < group_by_data_.size(); ++index) {
+                if (is_group(index)) {
+                    return index;
+                }
+            }
+        }
+        create_group();
+        return group_by_data_.size() - 1;
+    }
 
-    auto constructResult () {
-        using SummarizerIndices = std::make_index_sequence<CompoundSummarizer::NumSummarizers>;
-        return constructResultImpl(GroupByDataIndices{}, SummarizerIndices{});
+    /**
+     * Returns the slot of a group-by value in the key domain. Throws a SummarizeException for values
+     * outside of the domain.
+    */
+    template <typename T>
+    static std::size_t getDomainSlot (const T& value) {
+        const auto slot = static_cast<std::size_t>(static_cast<long long>(value) - Domain::BEGIN);
+        if (slot >= Domain::SIZE) {
+            throw SummarizeException{"Value of the group-by column is outside of the domain."};
+        }
+        return slot;
     }
 
-    template <std::size_t ...GroupByDataIndices, std::size_t ...SummarizerIndices>
-    auto constructResultImpl (std::integer_sequence<std::size_t, GroupByDataIndices...>, std::integer_sequence<std::size_t, SummarizerIndices...>) {
-        NewDataFrame result;
-        for (auto loop_index = 0LU; loop_index < group_by_data_.size(); ++loop_index) {
-            result.insert(
-                std::get<GroupByDataIndices>(group_by_data_[loop_index])...,
-                std::get<SummarizerIndices>(summarizer_data_[loop_index]).getState()...
-            );
+    std::uint64_t getMergeHash (const SummarizationExecuterGroupBy& other, std::size_t other_index) const {
+        if constexpr (USE_KEY_DOMAIN) {
+            return getDomainSlot(std::get<0>(other.group_by_data_[other_index]));
+        }
+        else if constexpr (USE_HASH_TABLE) {
+            return other.group_hashes_[other_index];
+        }
+        else {
+            return 0;
         }
-        return result;
     }
 
-private:
-    using GroupByDataIndices = std::make_index_sequence<get_integer_sequence_size<GroupByColumnIndices>>;
+    template <typename ColumnStoreData, std::size_t ...GroupByColumnIndicesInColumnStore>
+    static auto getRowKey (const ColumnStoreData& column_store_data, std::size_t row_index, std::integer_sequence<std::size_t, GroupByColumnIndicesInColumnStore...>) {
+        // references to the column values, except for std::vector<bool> whose elements are returned by value
+        return std::tuple<decltype(std::get<GroupByColumnIndicesInColumnStore>(column_store_data)[row_index])...>(
+            std::get<GroupByColumnIndicesInColumnStore>(column_store_data)[row_index]...
+        );
+    }
+
+    /**
+     * Checks that the key of a new run continues the direction of the previous runs.
+    */
+    template <typename Key>
+    void checkRunOrder (const Key& key) {
+        if constexpr (are_types_less_than_comparable<GroupByTypes>) {
+            if (group_by_data_.empty()) {
+                return;
+            }
+            const int direction = group_by_data_.back() < key ? 1 : -1;
+            if (run_direction_ != 0 && direction != run_direction_) {
+                throw SummarizeException{"Runs of the group-by columns are neither ascending nor descending."};
+            }
+            run_direction_ = direction;
+        }
+    }
+
+    template <typename ColumnStoreData, std::size_t ... GroupByColumnIndicesInColumnStore>
+    void createNewGroupByEntry (const ColumnStoreData& column_store_data, std::size_t row_index, std::integer_sequence<std::size_t, GroupByColumnIndicesInColumnStore...>) {
+        group_by_data_.push_back(
+            std::make_tuple(std::get<GroupByColumnIndicesInColumnStore>(column_store_data)[row_index]...)
+        );
+        summarizer_data_.push_back(CompoundSummarizer::create(*arenas_));
+    }
 
-    std::vector<GroupByTypes> group_by_data_{};;
+    template <typename ColumnStoreData, std::size_t ...GroupByDataIndicesInTuple, std::size_t ...GroupByColumnIndicesInColumnStore>
+    bool isGroupOfRow (std::size_t index, const ColumnStoreData& column_store_data, std::size_t row_index, std::integer_sequence<std::size_t, GroupByDataIndicesInTuple...>, std::integer_sequence<std::size_t, GroupByColumnIndicesInColumnStore...>) const {
+        return ((std::get<GroupByDataIndicesInTuple>(group_by_data_[index]) == std::get<GroupByColumnIndicesInColumnStore>(column_store_data)[row_index]) && ...);
+    }
+
+    void resizeSlots (std::size_t num_slots) {
+        slots_.assign(num_slots, EMPTY_SLOT);
+        for (auto index = 0LU; index < group_hashes_.size(); ++index) {
+            auto slot = group_hashes_[index] & (num_slots - 1);
+            while (slots_[slot] != EMPTY_SLOT) {
+                slot = (slot + 1) & (num_slots - 1);
+            }
+            slots_[slot] = index;
+        }
+    }
+
+    template <typename GroupByData, std::size_t ...GroupByDataIndicesInTuple, std::size_t ...ResultIndicesInData>
+    static NewDataFrame constructResultImpl (GroupByData& group_by_data, const std::vector<typename CompoundSummarizer::Data>& summarizer_data, std::integer_sequence<std::size_t, GroupByDataIndicesInTuple...>, std::integer_sequence<std::size_t, ResultIndicesInData...>) {
+        static constexpr std::size_t NUM_GROUP_BY_COLUMNS = sizeof...(GroupByDataIndicesInTuple);
+
+        NewDataFrame result;
+        // moving from const group-by data copies the values
+        (appendToColumn(std::get<GroupByDataIndicesInTuple>(result.column_store_data_), group_by_data.size(), [&](std::size_t index) {
+            return std::move(std::get<GroupByDataIndicesInTuple>(group_by_data[index]));
+        }), ...);
+        (appendToColumn(std::get<NUM_GROUP_BY_COLUMNS + ResultIndicesInData>(result.column_store_data_), summarizer_data.size(), [&](std::size_t index) {
+            return CompoundSummarizer::template getResult<ResultIndicesInData>(summarizer_data[index]);
+        }), ...);
+        return result;
+    }
+
+    std::unique_ptr<typename CompoundSummarizer::Arenas> arenas_ {std::make_unique<typename CompoundSummarizer::Arenas>()};
+    std::vector<std::unique_ptr<typename CompoundSummarizer::Arenas>> merged_arenas_{};
+    std::vector<GroupByTypes> group_by_data_{};
     std::vector<typename CompoundSummarizer::Data> summarizer_data_{};
+    std::vector<std::uint64_t> group_hashes_{};
+    std::vector<std::size_t> slots_{};
+    // group index of each value of the key domain, allocated on first use
+    std::vector<std::uint32_t> domain_slots_{};
+    // direction of the runs for SortedRuns: 1 ascending, -1 descending, 0 unknown
+    int run_direction_ {0};
 };
 
+// ############################################################################
+// Function: Execute Summarization
+// ############################################################################
+/**
+ * Summarizes the rows [begin, end) of a column store into the executer. The rows are split into
+ * blocks of a fixed size independent of the number of threads: the first block is summarized by
+ * the executer itself, each other block by a separate executer, and these are merged into the
+ * executer in the order of the blocks. Hence, the result is bit-identical for any number of
+ * threads, including the rounding of floating-point sums, and the groups keep their first-appearance
+ * order. For multiple threads, the blocks are summarized in waves of one block per thread.
+ *
+ * The merge of the blocks is sequential and costs one lookup per group of a block, which bounds
+ * the speedup of group-bys with many groups per block.
+ *
+ * Each executer of a block allocates a flat array over the whole key domain, such that a block
+ * spans at least as many rows as the domain has values. Summarizing fewer rows than a block (e.g.
+ * to refresh a summary) does not create any other executer.
+*/
+template <typename Executer, typename ColumnStoreData>
+void summarizeRows (Executer& executer, const ColumnStoreData& column_store_data, std::size_t begin, std::size_t end, std::size_t num_threads) {
+    static constexpr std::size_t MIN_BLOCK_SIZE = 262144;
+
+    std::size_t block_size = MIN_BLOCK_SIZE;
+    if constexpr (requires { Executer::KEY_DOMAIN_SIZE; }) {
+        block_size = std::max(block_size, Executer::KEY_DOMAIN_SIZE);
+    }
+    auto summarize_block = [&](Executer& block_executer, std::size_t block) {
+        const auto block_begin = begin + block * block_size;
+        const auto block_end = std::min(end, block_begin + block_size);
+        if constexpr (requires { block_executer.summarizeRange(column_store_data, block_begin, block_end); }) {
+            block_executer.summarizeRange(column_store_data, block_begin, block_end);
+        }
+        else {
+            for (auto row_index = block_begin; row_index < block_end; ++row_index) {
+                block_executer.summarize(column_store_data, row_index);
+            }
+        }
+    };
+
+    const std::size_t num_blocks = (end - begin + block_size - 1) / block_size;
+    const std::size_t num_blocks_per_wave = std::max(1LU, std::min(getNumThreads(num_threads), num_blocks));
+    for (auto wave_begin = 0LU; wave_begin < num_blocks; wave_begin += num_blocks_per_wave) {
+        const std::size_t num_wave_blocks = std::min(num_blocks_per_wave, num_blocks - wave_begin);
+        // the first block is summarized by the executer itself, which precedes the merge of all other blocks
+        const std::size_t first_other_block = wave_begin == 0 ? 1 : 0;
+        std::vector<Executer> block_executers(num_wave_blocks - first_other_block);
+        parallelFor(num_wave_blocks, num_wave_blocks, [&](std::size_t wave_block) {
+            if (wave_begin + wave_block == 0) {
+                summarize_block(executer, 0);
+            }
+            else {
+                summarize_block(block_executers[wave_block - first_other_block], wave_begin + wave_block);
+            }
+        });
+        for (auto& block_executer : block_executers) {
+            executer.merge(std::move(block_executer));
+        }
+    }
+}
+
+/**
+ * Summarizes all rows of a column store.
+*/
+template <typename Executer, typename ColumnStoreData>
+auto executeSummarization (const ColumnStoreData& column_store_data, std::size_t num_rows, std::size_t num_threads) {
+    Executer executer{};
+    summarizeRows(executer, column_store_data, 0, num_rows, num_threads);
+    return std::move(executer).constructResult();
+}
+
 } // namespace internal
 
 } // namespace dacr
 
-#endif // DATA_CRUNCHING_INTERNAL_DATAFRAME_PRINT_HPP
\ No newline at end of file
+#endif // DATA_CRUNCHING_INTERNAL_DATAFRAME_SUMMARIZE_HPP
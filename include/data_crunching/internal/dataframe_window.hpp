@@ -0,0 +1,431 @@
+// Copyright 2022 Andi Hellmund
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+#ifndef DATA_CRUNCHING_INTERNAL_DATAFRAME_WINDOW_HPP
+#define DATA_CRUNCHING_INTERNAL_DATAFRAME_WINDOW_HPP
+
+#include <algorithm>
+#include <numeric>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "data_crunching/internal/dataframe_rolling.hpp"
+#include "data_crunching/internal/dataframe_sort.hpp"
+#include "data_crunching/internal/fixed_string.hpp"
+#include "data_crunching/internal/name_list.hpp"
+#include "data_crunching/internal/type_list.hpp"
+#include "data_crunching/internal/utils.hpp"
+#include "data_crunching/internal/column.hpp"
+
+namespace dacr {
+
+template <FixedString ...PartitionNames>
+struct PartitionBy {
+    static constexpr std::size_t NumColumns = sizeof...(PartitionNames);
+    using Names = internal::NameList<PartitionNames...>;
+    using GroupBySpec = GroupBy<PartitionNames...>;
+};
+
+template <FixedString ...OrderByNames>
+struct OrderBy {
+    static constexpr SortOrder Order = SortOrder::Ascending;
+    static constexpr std::size_t NumColumns = sizeof...(OrderByNames);
+    using Names = internal::NameList<OrderByNames...>;
+};
+
+template <FixedString ...OrderByNames>
+struct OrderByDescending {
+    static constexpr SortOrder Order = SortOrder::Descending;
+    static constexpr std::size_t NumColumns = sizeof...(OrderByNames);
+    using Names = internal::NameList<OrderByNames...>;
+};
+
+/* number of the row within its partition, starting at 1 */
+template <FixedString NewColumnName>
+struct RowNumber {};
+
+/* rank of the row within its partition, starting at 1: rows with equal order-by values have the same rank, followed by a gap */
+template <FixedString NewColumnName>
+struct Rank {};
+
+/* as Rank, but without gaps */
+template <FixedString NewColumnName>
+struct DenseRank {};
+
+/* value of the row Offset rows before within the partition, or the default value of the type */
+template <FixedString ColumnName, FixedString NewColumnName, std::size_t Offset = 1>
+struct Lag {};
+
+/* value of the row Offset rows after within the partition, or the default value of the type */
+template <FixedString ColumnName, FixedString NewColumnName, std::size_t Offset = 1>
+struct Lead {};
+
+/* sum of the values of all rows up to and including the row within the partition */
+template <FixedString ColumnName, FixedString NewColumnName>
+struct CumSum {};
+
+namespace internal {
+
+// ############################################################################
+// Concept: Is Partition By / Order By
+// ############################################################################
+template <typename>
+struct IsPartitionBySpecImpl : std::false_type {};
+
+template <FixedString ...PartitionNames>
+struct IsPartitionBySpecImpl<PartitionBy<PartitionNames...>> : std::true_type {};
+
+template <typename T>
+concept IsPartitionBySpec = IsPartitionBySpecImpl<T>::value;
+
+template <typename>
+struct IsOrderBySpecImpl : std::false_type {};
+
+template <FixedString ...OrderByNames>
+struct IsOrderBySpecImpl<OrderBy<OrderByNames...>> : std::true_type {};
+
+template <FixedString ...OrderByNames>
+struct IsOrderBySpecImpl<OrderByDescending<OrderByNames...>> : std::true_type {};
+
+template <typename T>
+concept IsOrderBySpec = IsOrderBySpecImpl<T>::value;
+
+// ############################################################################
+// Concept: Is Window Op
+// ############################################################################
+template <typename>
+struct IsWindowOpImpl : std::false_type {};
+
+template <FixedString NewColumnName>
+struct IsWindowOpImpl<RowNumber<NewColumnName>> : std::true_type {};
+
+template <FixedString NewColumnName>
+struct IsWindowOpImpl<Rank<NewColumnName>> : std::true_type {};
+
+template <FixedString NewColumnName>
+struct IsWindowOpImpl<DenseRank<NewColumnName>> : std::true_type {};
+
+template <FixedString ColumnName, FixedString NewColumnName, std::size_t Offset>
+struct IsWindowOpImpl<Lag<ColumnName, NewColumnName, Offset>> : std::true_type {};
+
+template <FixedString ColumnName, FixedString NewColumnName, std::size_t Offset>
+struct IsWindowOpImpl<Lead<ColumnName, NewColumnName, Offset>> : std::true_type {};
+
+template <FixedString ColumnName, FixedString NewColumnName>
+struct IsWindowOpImpl<CumSum<ColumnName, NewColumnName>> : std::true_type {};
+
+template <typename T>
+concept IsWindowOp = IsWindowOpImpl<T>::value;
+
+// ############################################################################
+// Trait: Are Valid Window Ops
+// ############################################################################
+template <typename, typename ...>
+struct IsValidWindowOpImpl : std::true_type {};
+
+template <FixedString ColumnName, FixedString NewColumnName, std::size_t Offset, typename ...Columns>
+struct IsValidWindowOpImpl<Lag<ColumnName, NewColumnName, Offset>, Columns...> {
+    static constexpr bool value = is_name_in_columns<ColumnName, Columns...>;
+};
+
+template <FixedString ColumnName, FixedString NewColumnName, std::size_t Offset, typename ...Columns>
+struct IsValidWindowOpImpl<Lead<ColumnName, NewColumnName, Offset>, Columns...> {
+    static constexpr bool value = is_name_in_columns<ColumnName, Columns...>;
+};
+
+template <FixedString ColumnName, FixedString NewColumnName, typename ...Columns>
+struct IsValidWindowOpImpl<CumSum<ColumnName, NewColumnName>, Columns...> {
+    static constexpr bool value = is_name_in_columns<ColumnName, Columns...> && std::is_arithmetic_v<GetColumnTypeByName<ColumnName, Columns...>>;
+};
+
+template <typename ...>
+struct AreValidWindowOpsImpl : std::false_type {};
+
+template <typename ...Ops, typename ...Columns>
+struct AreValidWindowOpsImpl<TypeList<Ops...>, Columns...> {
+    static constexpr bool value = (IsValidWindowOpImpl<Ops, Columns...>::value && ...);
+};
+
+template <typename Ops, typename ...Columns>
+constexpr bool are_valid_window_ops = AreValidWindowOpsImpl<Ops, Columns...>::value;
+
+// ############################################################################
+// Class: Window Functions
+// ############################################################################
+/**
+ * Window functions are evaluated row by row in the order of a partition: next() returns the
+ * value of the row at the position within the sorted row indices of the partition. A row is
+ * a peer of the previous row if their order-by values are equal.
+*/
+class WindowRowNumber {
+public:
+    using TargetType = std::size_t;
+
+    template <typename DataIn>
+    std::size_t next (const DataIn&, std::span<const std::size_t>, std::size_t position, bool) {
+        return position + 1;
+    }
+};
+
+class WindowRank {
+public:
+    using TargetType = std::size_t;
+
+    template <typename DataIn>
+    std::size_t next (const DataIn&, std::span<const std::size_t>, std::size_t position, bool is_peer) {
+        if (not is_peer) {
+            rank_ = position + 1;
+        }
+        return rank_;
+    }
+
+private:
+    std::size_t rank_ {0};
+};
+
+class WindowDenseRank {
+public:
+    using TargetType = std::size_t;
+
+    template <typename DataIn>
+    std::size_t next (const DataIn&, std::span<const std::size_t>, std::size_t, bool is_peer) {
+        if (not is_peer) {
+            rank_ += 1;
+        }
+        return rank_;
+    }
+
+private:
+    std::size_t rank_ {0};
+};
+
+/**
+ * Value of the row Offset positions before (negative) or after (positive) the row.
+*/
+template <std::size_t InIndex, typename T, long long Offset>
+class WindowShift {
+public:
+    using TargetType = T;
+
+    template <typename DataIn>
+    T next (const DataIn& in, std::span<const std::size_t> row_indices, std::size_t position, bool) {
+        const auto shifted_position = static_cast<long long>(position) + Offset;
+        if (shifted_position < 0 || shifted_position >= static_cast<long long>(row_indices.size())) {
+            return T{};
+        }
+        return std::get<InIndex>(in)[row_indices[static_cast<std::size_t>(shifted_position)]];
+    }
+};
+
+template <std::size_t InIndex, IsArithmetic T>
+class WindowCumSum {
+public:
+    using TargetType = T;
+
+    template <typename DataIn>
+    T next (const DataIn& in, std::span<const std::size_t> row_indices, std::size_t position, bool) {
+        sum_ += std::get<InIndex>(in)[row_indices[position]];
+        return sum_;
+    }
+
+private:
+    T sum_ {0};
+};
+
+// ############################################################################
+// Trait: Get Window Function For Op
+// ############################################################################
+template <typename ...>
+struct GetWindowFunctionForOpImpl {};
+
+template <FixedString NewColumnName, typename ...Columns>
+struct GetWindowFunctionForOpImpl<RowNumber<NewColumnName>, Columns...> {
+    using type = WindowRowNumber;
+};
+
+template <FixedString NewColumnName, typename ...Columns>
+struct GetWindowFunctionForOpImpl<Rank<NewColumnName>, Columns...> {
+    using type = WindowRank;
+};
+
+template <FixedString NewColumnName, typename ...Columns>
+struct GetWindowFunctionForOpImpl<DenseRank<NewColumnName>, Columns...> {
+    using type = WindowDenseRank;
+};
+
+template <FixedString ColumnName, FixedString NewColumnName, std::size_t Offset, typename ...Columns>
+struct GetWindowFunctionForOpImpl<Lag<ColumnName, NewColumnName, Offset>, Columns...> {
+    using type = WindowShift<get_column_index_by_name<ColumnName, Columns...>, GetColumnTypeByName<ColumnName, Columns...>, -static_cast<long long>(Offset)>;
+};
+
+template <FixedString ColumnName, FixedString NewColumnName, std::size_t Offset, typename ...Columns>
+struct GetWindowFunctionForOpImpl<Lead<ColumnName, NewColumnName, Offset>, Columns...> {
+    using type = WindowShift<get_column_index_by_name<ColumnName, Columns...>, GetColumnTypeByName<ColumnName, Columns...>, static_cast<long long>(Offset)>;
+};
+
+template <FixedString ColumnName, FixedString NewColumnName, typename ...Columns>
+struct GetWindowFunctionForOpImpl<CumSum<ColumnName, NewColumnName>, Columns...> {
+    using type = WindowCumSum<get_column_index_by_name<ColumnName, Columns...>, GetColumnTypeByName<ColumnName, Columns...>>;
+};
+
+template <typename Op, typename ...Columns>
+using GetWindowFunctionForOp = typename GetWindowFunctionForOpImpl<Op, Columns...>::type;
+
+// ############################################################################
+// Trait: Get New Columns For Window Ops
+// ############################################################################
+template <typename>
+struct GetNewColumnNameForWindowOpImpl {};
+
+template <template <FixedString> typename Op, FixedString NewColumnName>
+struct GetNewColumnNameForWindowOpImpl<Op<NewColumnName>> {
+    static constexpr auto value = NewColumnName;
+};
+
+template <FixedString ColumnName, FixedString NewColumnName, std::size_t Offset>
+struct GetNewColumnNameForWindowOpImpl<Lag<ColumnName, NewColumnName, Offset>> {
+    static constexpr auto value = NewColumnName;
+};
+
+template <FixedString ColumnName, FixedString NewColumnName, std::size_t Offset>
+struct GetNewColumnNameForWindowOpImpl<Lead<ColumnName, NewColumnName, Offset>> {
+    static constexpr auto value = NewColumnName;
+};
+
+template <FixedString ColumnName, FixedString NewColumnName>
+struct GetNewColumnNameForWindowOpImpl<CumSum<ColumnName, NewColumnName>> {
+    static constexpr auto value = NewColumnName;
+};
+
+template <typename, typename ...>
+struct GetNewColumnsForWindowOpsImpl {};
+
+template <typename ...Ops, typename ...Columns>
+struct GetNewColumnsForWindowOpsImpl<TypeList<Ops...>, Columns...> {
+    using type = TypeList<
+        Column<GetNewColumnNameForWindowOpImpl<Ops>::value, typename GetWindowFunctionForOp<Ops, Columns...>::TargetType>...
+    >;
+};
+
+template <typename Ops, typename ...Columns>
+using GetNewColumnsForWindowOps = typename GetNewColumnsForWindowOpsImpl<Ops, Columns...>::type;
+
+// ############################################################################
+// Class: Window Executer
+// ############################################################################
+/**
+ * Evaluates the window functions: the rows of each partition are sorted once by the order-by
+ * columns (stable, such that peers keep the order of the DataFrame) and all window functions
+ * are evaluated in a single pass over the sorted rows.
+*/
+template <typename ElementComparison, typename ...WindowFunctions>
+class WindowExecuter {
+public:
+    using Results = std::tuple<std::vector<typename WindowFunctions::TargetType>...>;
+
+    explicit WindowExecuter (std::size_t num_rows) : results_{std::vector<typename WindowFunctions::TargetType>(num_rows)...} {}
+
+    /**
+     * Sorts the row indices of a partition and evaluates the window functions over them.
+    */
+    template <typename ColumnStoreData>
+    void evaluatePartition (const ColumnStoreData& column_store_data, std::span<std::size_t> row_indices) {
+        if constexpr (not std::is_same_v<ElementComparison, void>) {
+            std::stable_sort(row_indices.begin(), row_indices.end(), [&](std::size_t lhs, std::size_t rhs) {
+                return ElementComparison::compare(column_store_data, lhs, rhs);
+            });
+        }
+        evaluatePartitionImpl(column_store_data, row_indices, std::index_sequence_for<WindowFunctions...>{});
+    }
+
+    Results& getResults () {
+        return results_;
+    }
+
+private:
+    template <typename ColumnStoreData, std::size_t ...FunctionIndices>
+    void evaluatePartitionImpl (const ColumnStoreData& column_store_data, std::span<const std::size_t> row_indices, std::integer_sequence<std::size_t, FunctionIndices...>) {
+        std::tuple<WindowFunctions...> window_functions{};
+        for (auto position = 0LU; position < row_indices.size(); ++position) {
+            const bool is_peer = position > 0 && isPeer(column_store_data, row_indices[position - 1], row_indices[position]);
+            const std::size_t row_index = row_indices[position];
+            ((std::get<FunctionIndices>(results_)[row_index] = std::get<FunctionIndices>(window_functions).next(column_store_data, row_indices, position, is_peer)), ...);
+        }
+    }
+
+    template <typename ColumnStoreData>
+    static bool isPeer (const ColumnStoreData& column_store_data, std::size_t previous_row_index, std::size_t row_index) {
+        if constexpr (std::is_same_v<ElementComparison, void>) {
+            return true;
+        }
+        else {
+            // the rows are sorted, such that the previous row is not greater
+            return not ElementComparison::compare(column_store_data, previous_row_index, row_index);
+        }
+    }
+
+    Results results_;
+};
+
+template <typename OrderBySpec, typename OrderByColumnIndices>
+struct GetWindowElementComparisonImpl {
+    using type = ConstructElementComparison<OrderBySpec::Order, OrderByColumnIndices>;
+};
+
+template <typename OrderBySpec>
+struct GetWindowElementComparisonImpl<OrderBySpec, std::integer_sequence<std::size_t>> {
+    using type = void;
+};
+
+/**
+ * Computes the window ops and returns one result column per op.
+*/
+template <typename PartitionBySpec, typename OrderBySpec, typename Ops, typename ...Columns>
+struct WindowComputation {};
+
+template <typename PartitionBySpec, typename OrderBySpec, typename ...Ops, typename ...Columns>
+struct WindowComputation<PartitionBySpec, OrderBySpec, TypeList<Ops...>, Columns...> {
+    template <typename ColumnStoreData>
+    static auto compute (const ColumnStoreData& column_store_data, std::size_t num_rows) {
+        using PartitionColumnIndices = GetColumnIndicesByNames<typename PartitionBySpec::Names, Columns...>;
+        using PartitionTypes = typename GetColumnTypesByNames<typename PartitionBySpec::Names, Columns...>::template To<std::tuple>;
+        using OrderByColumnIndices = GetColumnIndicesByNames<typename OrderBySpec::Names, Columns...>;
+        using ElementComparison = typename GetWindowElementComparisonImpl<OrderBySpec, OrderByColumnIndices>::type;
+
+        WindowExecuter<ElementComparison, GetWindowFunctionForOp<Ops, Columns...>...> executer{num_rows};
+        if constexpr (PartitionBySpec::NumColumns == 0) {
+            std::vector<std::size_t> row_indices(num_rows);
+            std::iota(row_indices.begin(), row_indices.end(), 0LU);
+            executer.evaluatePartition(column_store_data, std::span<std::size_t>{row_indices});
+        }
+        else {
+            auto [row_indices, offsets] = partitionRows<typename PartitionBySpec::GroupBySpec, PartitionColumnIndices, PartitionTypes>(column_store_data, num_rows);
+            for (auto partition = 0LU; partition + 1 < offsets.size(); ++partition) {
+                executer.evaluatePartition(
+                    column_store_data,
+                    std::span<std::size_t>{row_indices.data() + offsets[partition], offsets[partition + 1] - offsets[partition]}
+                );
+            }
+        }
+        return std::move(executer.getResults());
+    }
+};
+
+} // namespace internal
+
+} // namespace dacr
+
+#endif // DATA_CRUNCHING_INTERNAL_DATAFRAME_WINDOW_HPP
@@ -0,0 +1,90 @@
+// Copyright 2022 Andi Hellmund
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+#ifndef DATA_CRUNCHING_INTERNAL_HASH_HPP
+#define DATA_CRUNCHING_INTERNAL_HASH_HPP
+
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+
+#include "data_crunching/internal/type_list.hpp"
+
+namespace dacr::internal {
+
+// ############################################################################
+// Concept: Is Hashable
+// ############################################################################
+template <typename T>
+concept IsHashable = requires (const T& value) {
+    { std::hash<T>{}(value) } -> std::convertible_to<std::size_t>;
+};
+
+template <typename ...>
+struct AreTypesHashableImpl : std::true_type {};
+
+template <typename ...Types>
+struct AreTypesHashableImpl<TypeList<Types...>> {
+    static constexpr bool value = (IsHashable<Types> && ...);
+};
+
+template <typename ...Types>
+struct AreTypesHashableImpl<std::tuple<Types...>> {
+    static constexpr bool value = (IsHashable<Types> && ...);
+};
+
+template <typename Types>
+constexpr bool are_types_hashable = AreTypesHashableImpl<Types>::value;
+
+// ############################################################################
+// Function: Hash Mixing
+// ############################################################################
+/**
+ * Finalizer of MurmurHash3 (fmix64). The standard library hashes integral types
+ * by identity, such that the low bits used to address hash table buckets (and
+ * the high bits used for partitioning) must be mixed first.
+*/
+constexpr std::uint64_t mixHash (std::uint64_t hash) {
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+constexpr std::uint64_t combineHashes (std::uint64_t seed, std::uint64_t hash) {
+    return seed ^ (hash + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2));
+}
+
+template <IsHashable T>
+std::uint64_t hashValue (const T& value) {
+    return std::hash<T>{}(value);
+}
+
+// ############################################################################
+// Function: Hash Column Store Row
+// ############################################################################
+template <typename ColumnStoreData, std::size_t ...Indices>
+std::uint64_t hashColumnStoreRow (const ColumnStoreData& column_store_data, std::size_t row_index, std::integer_sequence<std::size_t, Indices...>) {
+    std::uint64_t hash {0};
+    ((hash = combineHashes(hash, hashValue<typename std::tuple_element_t<Indices, ColumnStoreData>::value_type>(std::get<Indices>(column_store_data)[row_index]))), ...);
+    return mixHash(hash);
+}
+
+} // namespace dacr::internal
+
+#endif // DATA_CRUNCHING_INTERNAL_HASH_HPP
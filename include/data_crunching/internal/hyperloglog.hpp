@@ -0,0 +1,93 @@
+// Copyright 2022 Andi Hellmund
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+#ifndef DATA_CRUNCHING_INTERNAL_HYPERLOGLOG_HPP
+#define DATA_CRUNCHING_INTERNAL_HYPERLOGLOG_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+
+namespace dacr::internal {
+
+// ############################################################################
+// Class: HyperLogLog
+// ############################################################################
+/**
+ * HyperLogLog sketch estimating the number of distinct (well-mixed) 64-bit hashes.
+ *
+ * The sketch uses 2^Precision registers of one byte each: the top Precision bits of a hash
+ * select a register, which keeps the maximum number of leading zeros of the remaining bits.
+ * The relative standard error is about 1.04 / sqrt(2^Precision), e.g. 1.6% for Precision 12
+ * using 4 KB. Small cardinalities are estimated by linear counting of the empty registers.
+*/
+template <std::size_t Precision>
+requires (Precision >= 4 && Precision <= 18)
+class HyperLogLog {
+public:
+    static constexpr std::size_t NUM_REGISTERS = std::size_t{1} << Precision;
+
+    void insert (std::uint64_t hash) {
+        const auto index = hash >> (64 - Precision);
+        // the guard bit limits the rank for hashes with only zeros in the remaining bits
+        const auto remaining = (hash << Precision) | (std::uint64_t{1} << (Precision - 1));
+        const auto rank = static_cast<std::uint8_t>(std::countl_zero(remaining) + 1);
+        registers_[index] = std::max(registers_[index], rank);
+    }
+
+    void merge (const HyperLogLog& other) {
+        for (auto index = 0LU; index < NUM_REGISTERS; ++index) {
+            registers_[index] = std::max(registers_[index], other.registers_[index]);
+        }
+    }
+
+    double getEstimate () const {
+        double inverse_sum {0};
+        std::size_t num_empty_registers {0};
+        for (auto rank : registers_) {
+            inverse_sum += std::ldexp(1.0, -static_cast<int>(rank));
+            num_empty_registers += (rank == 0);
+        }
+        constexpr double num_registers = static_cast<double>(NUM_REGISTERS);
+        const double estimate = getAlpha() * num_registers * num_registers / inverse_sum;
+        if (estimate <= 2.5 * num_registers && num_empty_registers > 0) {
+            return num_registers * std::log(num_registers / static_cast<double>(num_empty_registers));
+        }
+        return estimate;
+    }
+
+private:
+    static constexpr double getAlpha () {
+        if constexpr (NUM_REGISTERS == 16) {
+            return 0.673;
+        }
+        else if constexpr (NUM_REGISTERS == 32) {
+            return 0.697;
+        }
+        else if constexpr (NUM_REGISTERS == 64) {
+            return 0.709;
+        }
+        else {
+            return 0.7213 / (1.0 + 1.079 / static_cast<double>(NUM_REGISTERS));
+        }
+    }
+
+    std::array<std::uint8_t, NUM_REGISTERS> registers_{};
+};
+
+} // namespace dacr::internal
+
+#endif // DATA_CRUNCHING_INTERNAL_HYPERLOGLOG_HPP
@@ -0,0 +1,81 @@
+// Copyright 2022 Andi Hellmund
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+#ifndef DATA_CRUNCHING_INTERNAL_PARALLEL_HPP
+#define DATA_CRUNCHING_INTERNAL_PARALLEL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace dacr::internal {
+
+/**
+ * Resolves the number of threads to use: 0 refers to all hardware threads.
+*/
+inline std::size_t getNumThreads (std::size_t requested_num_threads) {
+    if (requested_num_threads == 0) {
+        return std::max(1U, std::thread::hardware_concurrency());
+    }
+    return requested_num_threads;
+}
+
+/**
+ * Executes func(task_index) for all tasks in [0, num_tasks) on up to num_threads threads.
+ *
+ * The calling thread participates in the execution. Tasks are handed out dynamically,
+ * such that tasks of different cost are balanced across the threads. The first exception
+ * thrown by a task is rethrown to the caller once all threads have finished.
+*/
+template <typename Func>
+void parallelFor (std::size_t num_tasks, std::size_t num_threads, Func&& func) {
+    std::atomic<std::size_t> next_task_index {0};
+    std::exception_ptr first_exception {nullptr};
+    std::mutex exception_mutex {};
+
+    auto worker = [&]() {
+        for (auto task_index = next_task_index++; task_index < num_tasks; task_index = next_task_index++) {
+            try {
+                func(task_index);
+            }
+            catch (...) {
+                std::lock_guard lock{exception_mutex};
+                if (not first_exception) {
+                    first_exception = std::current_exception();
+                }
+                next_task_index = num_tasks;
+            }
+        }
+    };
+
+    const std::size_t num_workers = std::min(getNumThreads(num_threads), num_tasks);
+    std::vector<std::jthread> threads {};
+    for (auto thread_index = 1LU; thread_index < num_workers; ++thread_index) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    // joins all threads
+    threads.clear();
+
+    if (first_exception) {
+        std::rethrow_exception(first_exception);
+    }
+}
+
+} // namespace dacr::internal
+
+#endif // DATA_CRUNCHING_INTERNAL_PARALLEL_HPP
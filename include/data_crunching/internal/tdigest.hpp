@@ -0,0 +1,161 @@
+// Copyright 2022 Andi Hellmund
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+#ifndef DATA_CRUNCHING_INTERNAL_TDIGEST_HPP
+#define DATA_CRUNCHING_INTERNAL_TDIGEST_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numbers>
+#include <vector>
+
+namespace dacr::internal {
+
+// ############################################################################
+// Class: T-Digest
+// ############################################################################
+/**
+ * Merging t-digest of Dunning estimating quantiles in bounded memory.
+ *
+ * Values are collected in a buffer, which is merged with the sorted centroids (mean, weight)
+ * once full. Centroids are limited by the scale function k(q) = Compression / (2 pi) * asin(2q - 1),
+ * such that centroids near the tails (q close to 0 or 1) are small and the tail quantiles
+ * accurate. The number of centroids is at most about Compression, the buffer holds
+ * 5 * Compression entries.
+*/
+template <std::size_t Compression>
+requires (Compression >= 10)
+class TDigest {
+public:
+    void insert (double value) {
+        buffer_.push_back(Centroid{value, 1.0});
+        min_value_ = std::min(min_value_, value);
+        max_value_ = std::max(max_value_, value);
+        if (buffer_.size() >= BUFFER_SIZE) {
+            compress();
+        }
+    }
+
+    void merge (const TDigest& other) {
+        buffer_.insert(buffer_.end(), other.centroids_.begin(), other.centroids_.end());
+        buffer_.insert(buffer_.end(), other.buffer_.begin(), other.buffer_.end());
+        min_value_ = std::min(min_value_, other.min_value_);
+        max_value_ = std::max(max_value_, other.max_value_);
+        compress();
+    }
+
+    /**
+     * Merges the buffered values into the centroids.
+    */
+    void compress () {
+        if (buffer_.empty()) {
+            return;
+        }
+        buffer_.insert(buffer_.end(), centroids_.begin(), centroids_.end());
+        std::sort(buffer_.begin(), buffer_.end(), [](const Centroid& lhs, const Centroid& rhs) {
+            return lhs.mean < rhs.mean;
+        });
+        double total_weight {0};
+        for (const auto& centroid : buffer_) {
+            total_weight += centroid.weight;
+        }
+
+        centroids_.clear();
+        Centroid current = buffer_[0];
+        double weight_before_current {0};
+        double weight_limit = total_weight * getWeightLimit(0.0);
+        for (auto index = 1LU; index < buffer_.size(); ++index) {
+            const auto& next = buffer_[index];
+            if (weight_before_current + current.weight + next.weight <= weight_limit) {
+                current.weight += next.weight;
+                current.mean += (next.mean - current.mean) * next.weight / current.weight;
+            }
+            else {
+                weight_before_current += current.weight;
+                centroids_.push_back(current);
+                weight_limit = total_weight * getWeightLimit(weight_before_current / total_weight);
+                current = next;
+            }
+        }
+        centroids_.push_back(current);
+        buffer_.clear();
+    }
+
+    /**
+     * Returns the estimated quantile q in [0, 1] by interpolating linearly between the centers
+     * of adjacent centroids, and between the outer centroids and the minimum/maximum.
+     * The digest must be compressed. Returns NaN for an empty digest.
+    */
+    double getQuantile (double q) const {
+        if (centroids_.empty()) {
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+        double total_weight {0};
+        for (const auto& centroid : centroids_) {
+            total_weight += centroid.weight;
+        }
+        const double target = std::clamp(q, 0.0, 1.0) * total_weight;
+
+        const auto& first = centroids_.front();
+        if (target < first.weight / 2) {
+            return min_value_ + (first.mean - min_value_) * target / (first.weight / 2);
+        }
+        double weight_before {0};
+        for (auto index = 0LU; index + 1 < centroids_.size(); ++index) {
+            const auto& left = centroids_[index];
+            const auto& right = centroids_[index + 1];
+            const double left_center = weight_before + left.weight / 2;
+            const double right_center = weight_before + left.weight + right.weight / 2;
+            if (target <= right_center) {
+                return left.mean + (right.mean - left.mean) * (target - left_center) / (right_center - left_center);
+            }
+            weight_before += left.weight;
+        }
+        const auto& last = centroids_.back();
+        const double last_center = total_weight - last.weight / 2;
+        return last.mean + (max_value_ - last.mean) * std::min(1.0, (target - last_center) / (last.weight / 2));
+    }
+
+    std::size_t getNumCentroids () const {
+        return centroids_.size();
+    }
+
+private:
+    struct Centroid {
+        double mean;
+        double weight;
+    };
+
+    static constexpr std::size_t BUFFER_SIZE = 5 * Compression;
+
+    /**
+     * Returns the maximal quantile (as fraction of the total weight) up to which a centroid
+     * starting at quantile q may grow: k^-1(k(q) + 1).
+    */
+    static double getWeightLimit (double q) {
+        constexpr double scale = static_cast<double>(Compression) / (2 * std::numbers::pi);
+        const double k = scale * std::asin(2 * q - 1) + 1;
+        return (std::sin(std::min(k / scale, std::numbers::pi / 2)) + 1) / 2;
+    }
+
+    std::vector<Centroid> centroids_{};
+    std::vector<Centroid> buffer_{};
+    double min_value_ {std::numeric_limits<double>::max()};
+    double max_value_ {std::numeric_limits<double>::lowest()};
+};
+
+} // namespace dacr::internal
+
+#endif // DATA_CRUNCHING_INTERNAL_TDIGEST_HPP
@@ -15,6 +15,8 @@
 #ifndef DATA_CRUNCHING_INTERNAL_TYPE_LIST_HPP
 #define DATA_CRUNCHING_INTERNAL_TYPE_LIST_HPP
 
+#include <type_traits>
+
 #include "data_crunching/internal/fixed_string.hpp"
 
 namespace dacr {
@@ -59,6 +61,57 @@ struct ConvertTypeListToTupleImpl<TypeList<Types...>> {
 template <typename Types>
 using ConvertTypeListToTuple = typename ConvertTypeListToTupleImpl<Types>::type;
 
+// ############################################################################
+// Trait: Type List Index
+// ############################################################################
+template <typename, typename>
+struct TypeListIndexImpl {};
+
+template <typename T, typename ...TypesInList>
+struct TypeListIndexImpl<T, TypeList<T, TypesInList...>> {
+    static constexpr std::size_t value = 0;
+};
+
+template <typename T, typename FirstType, typename ...TypesInList>
+struct TypeListIndexImpl<T, TypeList<FirstType, TypesInList...>> {
+    static constexpr std::size_t value = 1 + TypeListIndexImpl<T, TypeList<TypesInList...>>::value;
+};
+
+/**
+ * Index of the first occurrence of T in the list.
+*/
+template <typename T, typename List>
+constexpr std::size_t type_list_index = TypeListIndexImpl<T, List>::value;
+
+// ############################################################################
+// Trait: Unique Type List
+// ############################################################################
+template <typename, typename>
+struct TypeListUniqueImpl {};
+
+template <typename ...UniqueTypes>
+struct TypeListUniqueImpl<TypeList<UniqueTypes...>, TypeList<>> {
+    using type = TypeList<UniqueTypes...>;
+};
+
+template <typename ...UniqueTypes, typename FirstType, typename ...RestTypes>
+struct TypeListUniqueImpl<TypeList<UniqueTypes...>, TypeList<FirstType, RestTypes...>> {
+    using type = typename TypeListUniqueImpl<
+        std::conditional_t<
+            (std::is_same_v<FirstType, UniqueTypes> || ...),
+            TypeList<UniqueTypes...>,
+            TypeList<UniqueTypes..., FirstType>
+        >,
+        TypeList<RestTypes...>
+    >::type;
+};
+
+/**
+ * Removes duplicate types from the list, keeping the first occurrence of each type.
+*/
+template <typename List>
+using TypeListUnique = typename TypeListUniqueImpl<TypeList<>, List>::type;
+
 } // namespace internal
 
 } // namespace dacr
@@ -15,6 +15,7 @@
 #ifndef DATA_CRUNCHING_INTERNAL_UTILS_HPP
 #define DATA_CRUNCHING_INTERNAL_UTILS_HPP
 
+#include <concepts>
 #include <ranges>
 #include <tuple>
 
@@ -36,6 +37,27 @@ concept IsIntegral = std::is_integral_v<T>;
 template <typename T>
 concept IsFloatingPoint = std::is_floating_point_v<T>;
 
+template <typename T>
+concept IsLessThanComparable = requires (const T& lhs, const T& rhs) {
+    { lhs < rhs } -> std::convertible_to<bool>;
+};
+
+template <typename ...>
+struct AreTypesLessThanComparableImpl : std::true_type {};
+
+template <typename ...Types>
+struct AreTypesLessThanComparableImpl<TypeList<Types...>> {
+    static constexpr bool value = (IsLessThanComparable<Types> && ...);
+};
+
+template <typename ...Types>
+struct AreTypesLessThanComparableImpl<std::tuple<Types...>> {
+    static constexpr bool value = (IsLessThanComparable<Types> && ...);
+};
+
+template <typename Types>
+constexpr bool are_types_less_than_comparable = AreTypesLessThanComparableImpl<Types>::value;
+
 
 // ############################################################################
 // Trait: Tuple Prepend
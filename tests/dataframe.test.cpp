@@ -15,7 +15,10 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include <algorithm>
 #include <sstream>
+#include <string>
+#include <tuple>
 #include <vector>
 #include <ranges>
 
@@ -198,6 +201,313 @@ TEST(DataFrame, JoinWithType) {
     EXPECT_THAT(dfjoined.getColumn<"flt">(), ::testing::ElementsAre(50.0f));
 }
 
+TEST(DataFrame, JoinWithMultipleMatches) {
+    DataFrame<
+        Column<"id", std::string>,
+        Column<"left", int>
+    > testdf1;
+    testdf1.insert("a", 1);
+    testdf1.insert("b", 2);
+    testdf1.insert("a", 3);
+    testdf1.insert("c", 4);
+
+    DataFrame<
+        Column<"id", std::string>,
+        Column<"right", double>
+    > testdf2;
+    testdf2.insert("a", 10.0);
+    testdf2.insert("a", 20.0);
+    testdf2.insert("c", 30.0);
+
+    // hash table on the smaller (right) side: rows are ordered by the left side
+    auto dfjoined_right_build = testdf1.join<Join::Inner, "id">(testdf2);
+    EXPECT_THAT(dfjoined_right_build.getColumn<"id">(), ::testing::ElementsAre("a", "a", "a", "a", "c"));
+    EXPECT_THAT(dfjoined_right_build.getColumn<"left">(), ::testing::ElementsAre(1, 1, 3, 3, 4));
+    EXPECT_THAT(dfjoined_right_build.getColumn<"right">(), ::testing::ElementsAre(10.0, 20.0, 10.0, 20.0, 30.0));
+
+    auto dfjoined_nested_loop = testdf1.join<Join::Inner, "id">(testdf2, {.strategy = JoinStrategy::NestedLoop});
+    EXPECT_EQ(dfjoined_nested_loop.getColumn<"id">(), dfjoined_right_build.getColumn<"id">());
+    EXPECT_EQ(dfjoined_nested_loop.getColumn<"left">(), dfjoined_right_build.getColumn<"left">());
+    EXPECT_EQ(dfjoined_nested_loop.getColumn<"right">(), dfjoined_right_build.getColumn<"right">());
+
+    auto dfjoined_bloom_filter = testdf1.join<Join::Inner, "id">(testdf2, {.bloom_filter = JoinBloomFilter::Enabled});
+    EXPECT_EQ(dfjoined_bloom_filter.getColumn<"left">(), dfjoined_right_build.getColumn<"left">());
+    EXPECT_EQ(dfjoined_bloom_filter.getColumn<"right">(), dfjoined_right_build.getColumn<"right">());
+
+    // hash table on the smaller (left) side: rows are still ordered by the left side
+    auto dfjoined_left_build = testdf2.join<Join::Inner, "id">(testdf1);
+    EXPECT_THAT(dfjoined_left_build.getColumn<"id">(), ::testing::ElementsAre("a", "a", "a", "a", "c"));
+    EXPECT_THAT(dfjoined_left_build.getColumn<"right">(), ::testing::ElementsAre(10.0, 10.0, 20.0, 20.0, 30.0));
+    EXPECT_THAT(dfjoined_left_build.getColumn<"left">(), ::testing::ElementsAre(1, 3, 1, 3, 4));
+
+    auto dfjoined_left_nested_loop = testdf2.join<Join::Inner, "id">(testdf1, {.strategy = JoinStrategy::NestedLoop});
+    EXPECT_EQ(dfjoined_left_nested_loop.getColumn<"right">(), dfjoined_left_build.getColumn<"right">());
+    EXPECT_EQ(dfjoined_left_nested_loop.getColumn<"left">(), dfjoined_left_build.getColumn<"left">());
+}
+
+TEST(DataFrame, JoinOrderWithSmallerLeftSide) {
+    DataFrame<Column<"id", int>, Column<"left", int>> testdf1;
+    testdf1.insert(1, 10);
+    testdf1.insert(2, 20);
+
+    DataFrame<Column<"id", int>, Column<"right", int>> testdf2;
+    testdf2.insert(2, 200);
+    testdf2.insert(1, 100);
+    testdf2.insert(1, 101);
+    testdf2.insert(2, 201);
+
+    auto dfjoined = testdf1.join<Join::Inner, "id">(testdf2);
+    EXPECT_THAT(dfjoined.getColumn<"left">(), ::testing::ElementsAre(10, 10, 20, 20));
+    EXPECT_THAT(dfjoined.getColumn<"right">(), ::testing::ElementsAre(100, 101, 200, 201));
+
+    auto dfjoined_bloom_filter = testdf1.join<Join::Inner, "id">(testdf2, {.bloom_filter = JoinBloomFilter::Enabled});
+    EXPECT_EQ(dfjoined_bloom_filter.getColumn<"left">(), dfjoined.getColumn<"left">());
+    EXPECT_EQ(dfjoined_bloom_filter.getColumn<"right">(), dfjoined.getColumn<"right">());
+}
+
+TEST(DataFrame, JoinSortMerge) {
+    DataFrame<
+        Column<"id", int>,
+        Column<"sub", char>,
+        Column<"left", double>
+    > testdf1;
+    testdf1.insert(3, 'A', 1.0);
+    testdf1.insert(1, 'B', 2.0);
+    testdf1.insert(1, 'A', 3.0);
+    testdf1.insert(2, 'A', 4.0);
+
+    DataFrame<
+        Column<"id", int>,
+        Column<"sub", char>,
+        Column<"right", int>
+    > testdf2;
+    testdf2.insert(1, 'A', 10);
+    testdf2.insert(3, 'A', 20);
+    testdf2.insert(1, 'A', 30);
+
+    auto sorted_df1 = testdf1.sort<SortOrder::Ascending, "id", "sub">();
+    auto sorted_df2 = testdf2.sort<SortOrder::Ascending, "id", "sub">();
+    auto dfjoined = sorted_df1.join<Join::Inner, "id", "sub">(sorted_df2, {.strategy = JoinStrategy::SortMerge});
+    EXPECT_THAT(dfjoined.getColumn<"id">(), ::testing::ElementsAre(1, 1, 3));
+    EXPECT_THAT(dfjoined.getColumn<"sub">(), ::testing::ElementsAre('A', 'A', 'A'));
+    EXPECT_THAT(dfjoined.getColumn<"left">(), ::testing::ElementsAre(3.0, 3.0, 1.0));
+    EXPECT_THAT(dfjoined.getColumn<"right">(), ::testing::UnorderedElementsAre(10, 30, 20));
+
+    EXPECT_THROW((testdf1.join<Join::Inner, "id", "sub">(sorted_df2, {.strategy = JoinStrategy::SortMerge})), JoinException);
+}
+
+TEST(DataFrame, JoinPartitionedHash) {
+    DataFrame<
+        Column<"id", int>,
+        Column<"flag", bool>
+    > testdf1;
+    DataFrame<
+        Column<"id", int>,
+        Column<"name", std::string>,
+        Column<"other_flag", bool>
+    > testdf2;
+    for (int i = 0; i < 10'000; ++i) {
+        testdf1.insert(i % 3'000, i % 2 == 0);
+    }
+    for (int i = 0; i < 2'000; ++i) {
+        testdf2.insert(i * 2, std::to_string(i * 2), i % 3 == 0);
+    }
+
+    auto dfjoined_hash = testdf1.join<Join::Inner, "id">(testdf2);
+    auto dfjoined_partitioned = testdf1.join<Join::Inner, "id">(testdf2, {.strategy = JoinStrategy::PartitionedHash, .num_threads = 4});
+
+    auto get_rows = [](const auto& df) {
+        std::vector<std::tuple<int, bool, std::string, bool>> rows;
+        for (auto i = 0LU; i < df.getSize(); ++i) {
+            rows.emplace_back(df.template getColumn<"id">()[i], df.template getColumn<"flag">()[i], df.template getColumn<"name">()[i], df.template getColumn<"other_flag">()[i]);
+        }
+        std::ranges::sort(rows);
+        return rows;
+    };
+    EXPECT_EQ(dfjoined_partitioned.getSize(), 5'000);
+    EXPECT_EQ(get_rows(dfjoined_partitioned), get_rows(dfjoined_hash));
+    EXPECT_TRUE(std::ranges::all_of(get_rows(dfjoined_partitioned), [](const auto& row) {
+        return std::to_string(std::get<0>(row)) == std::get<2>(row);
+    }));
+}
+
+struct NonHashableId {
+    int id;
+    bool operator== (const NonHashableId&) const = default;
+};
+
+TEST(DataFrame, JoinWithNonHashableType) {
+    DataFrame<
+        Column<"id", NonHashableId>,
+        Column<"left", int>
+    > testdf1;
+    testdf1.insert(NonHashableId{1}, 10);
+    testdf1.insert(NonHashableId{2}, 20);
+
+    DataFrame<
+        Column<"id", NonHashableId>,
+        Column<"right", int>
+    > testdf2;
+    testdf2.insert(NonHashableId{2}, 200);
+
+    auto dfjoined = testdf1.join<Join::Inner, "id">(testdf2);
+    EXPECT_THAT(dfjoined.getColumn<"left">(), ::testing::ElementsAre(20));
+    EXPECT_THAT(dfjoined.getColumn<"right">(), ::testing::ElementsAre(200));
+}
+
+TEST(DataFrame, JoinRowsAndMaterialize) {
+    DataFrame<
+        Column<"id", int>,
+        Column<"left", std::string>,
+        Column<"flag", bool>
+    > testdf1;
+    testdf1.insert(1, "one", true);
+    testdf1.insert(2, "two", false);
+    testdf1.insert(1, "uno", false);
+
+    DataFrame<
+        Column<"id", int>,
+        Column<"right", double>
+    > testdf2;
+    testdf2.insert(1, 10.0);
+    testdf2.insert(3, 30.0);
+
+    auto joined_rows = testdf1.joinRows<Join::Inner, "id">(testdf2);
+    EXPECT_EQ(joined_rows.getSize(), 2);
+    EXPECT_THAT(joined_rows.getLeftRowIndices(), ::testing::ElementsAre(0, 2));
+    EXPECT_THAT(joined_rows.getRightRowIndices(), ::testing::ElementsAre(0, 0));
+
+    auto dfselected = joined_rows.materialize<"right", "flag">();
+    EXPECT_TRUE((std::is_same_v<
+        decltype(dfselected),
+        DataFrame<Column<"right", double>, Column<"flag", bool>>
+    >));
+    EXPECT_THAT(dfselected.getColumn<"right">(), ::testing::ElementsAre(10.0, 10.0));
+    EXPECT_THAT(dfselected.getColumn<"flag">(), ::testing::ElementsAre(true, false));
+
+    auto dfall = joined_rows.materialize();
+    EXPECT_TRUE((std::is_same_v<decltype(dfall), decltype(testdf1.join<Join::Inner, "id">(testdf2))>));
+    EXPECT_THAT(dfall.getColumn<"id">(), ::testing::ElementsAre(1, 1));
+    EXPECT_THAT(dfall.getColumn<"left">(), ::testing::ElementsAre("one", "uno"));
+    EXPECT_THAT(dfall.getColumn<"right">(), ::testing::ElementsAre(10.0, 10.0));
+}
+
+TEST(DataFrame, JoinWithJoinIndex) {
+    DataFrame<
+        Column<"id", int>,
+        Column<"name", std::string>
+    > dimensiondf;
+    dimensiondf.insert(1, "one");
+    dimensiondf.insert(2, "two");
+
+    auto join_index = dimensiondf.buildJoinIndex<"id">();
+    EXPECT_EQ(join_index.getSize(), 2);
+
+    DataFrame<
+        Column<"id", int>,
+        Column<"value", double>
+    > batchdf;
+    batchdf.insert(2, 20.0);
+    batchdf.insert(3, 30.0);
+    batchdf.insert(1, 10.0);
+
+    auto dfjoined = batchdf.join<Join::Inner>(join_index);
+    EXPECT_TRUE((std::is_same_v<decltype(dfjoined), decltype(batchdf.join<Join::Inner, "id">(dimensiondf))>));
+    EXPECT_THAT(dfjoined.getColumn<"id">(), ::testing::ElementsAre(2, 1));
+    EXPECT_THAT(dfjoined.getColumn<"value">(), ::testing::ElementsAre(20.0, 10.0));
+    EXPECT_THAT(dfjoined.getColumn<"name">(), ::testing::ElementsAre("two", "one"));
+
+    // appended rows are added to the index on the next join
+    dimensiondf.insert(3, "three");
+    dimensiondf.insert(1, "uno");
+    auto dfjoined_appended = batchdf.join<Join::Inner, "id">(join_index);
+    EXPECT_EQ(join_index.getSize(), 4);
+    EXPECT_THAT(dfjoined_appended.getColumn<"id">(), ::testing::ElementsAre(2, 3, 1, 1));
+    EXPECT_THAT(dfjoined_appended.getColumn<"name">(), ::testing::ElementsAre("two", "three", "one", "uno"));
+
+    auto joined_rows = batchdf.joinRows<Join::Inner>(join_index);
+    EXPECT_THAT(joined_rows.getLeftRowIndices(), ::testing::ElementsAre(0, 1, 2, 2));
+    EXPECT_THAT(joined_rows.getRightRowIndices(), ::testing::ElementsAre(1, 2, 0, 3));
+}
+
+TEST(DataFrame, JoinSemiAndAnti) {
+    DataFrame<
+        Column<"id", int>,
+        Column<"value", double>,
+        Column<"flag", bool>
+    > testdf1;
+    testdf1.insert(1, 10.0, true);
+    testdf1.insert(2, 20.0, false);
+    testdf1.insert(3, 30.0, true);
+    testdf1.insert(1, 40.0, false);
+
+    // same non-join column name as testdf1 and multiple matches per key
+    DataFrame<
+        Column<"id", int>,
+        Column<"value", std::string>
+    > testdf2;
+    testdf2.insert(1, "a");
+    testdf2.insert(1, "b");
+    testdf2.insert(3, "c");
+
+    auto dfsemi = testdf1.join<Join::Semi, "id">(testdf2);
+    EXPECT_TRUE((std::is_same_v<decltype(dfsemi), decltype(testdf1)>));
+    EXPECT_THAT(dfsemi.getColumn<"id">(), ::testing::ElementsAre(1, 3, 1));
+    EXPECT_THAT(dfsemi.getColumn<"value">(), ::testing::ElementsAre(10.0, 30.0, 40.0));
+    EXPECT_THAT(dfsemi.getColumn<"flag">(), ::testing::ElementsAre(true, true, false));
+
+    auto dfanti = testdf1.join<Join::Anti, "id">(testdf2);
+    EXPECT_TRUE((std::is_same_v<decltype(dfanti), decltype(testdf1)>));
+    EXPECT_THAT(dfanti.getColumn<"id">(), ::testing::ElementsAre(2));
+    EXPECT_THAT(dfanti.getColumn<"value">(), ::testing::ElementsAre(20.0));
+
+    // the hash table is built on the smaller (left) side
+    auto dfsemi_small = dfanti.join<Join::Semi, "id">(testdf1);
+    EXPECT_THAT(dfsemi_small.getColumn<"id">(), ::testing::ElementsAre(2));
+
+    auto dfsemi_nested_loop = testdf1.join<Join::Semi, "id">(testdf2, {.strategy = JoinStrategy::NestedLoop});
+    EXPECT_EQ(dfsemi_nested_loop.getColumn<"value">(), dfsemi.getColumn<"value">());
+
+    auto join_index = testdf2.buildJoinIndex<"id">();
+    auto dfanti_index = testdf1.join<Join::Anti>(join_index);
+    EXPECT_EQ(dfanti_index.getColumn<"value">(), dfanti.getColumn<"value">());
+}
+
+TEST(DataFrame, JoinAsOf) {
+    DataFrame<
+        Column<"symbol", std::string>,
+        Column<"ts", int>,
+        Column<"quantity", int>
+    > trades;
+    trades.insert("A", 5, 100);
+    trades.insert("A", 10, 200);
+    trades.insert("A", 12, 300);
+    trades.insert("B", 3, 400);
+    trades.insert("B", 8, 500);
+    trades.insert("C", 1, 600);
+
+    DataFrame<
+        Column<"symbol", std::string>,
+        Column<"ts", int>,
+        Column<"price", double>
+    > quotes;
+    quotes.insert("A", 1, 1.0);
+    quotes.insert("A", 10, 2.0);
+    quotes.insert("A", 11, 3.0);
+    quotes.insert("B", 4, 4.0);
+    quotes.insert("C", 2, 5.0);
+
+    auto dfjoined = trades.join<Join::AsOf, "symbol", "ts">(quotes);
+    EXPECT_TRUE((std::is_same_v<decltype(dfjoined), decltype(trades.join<Join::Inner, "symbol", "ts">(quotes))>));
+    EXPECT_THAT(dfjoined.getColumn<"symbol">(), ::testing::ElementsAre("A", "A", "A", "B"));
+    EXPECT_THAT(dfjoined.getColumn<"ts">(), ::testing::ElementsAre(5, 10, 12, 8));
+    EXPECT_THAT(dfjoined.getColumn<"quantity">(), ::testing::ElementsAre(100, 200, 300, 500));
+    EXPECT_THAT(dfjoined.getColumn<"price">(), ::testing::ElementsAre(1.0, 2.0, 3.0, 4.0));
+
+    auto unsorted_quotes = quotes.sort<SortOrder::Descending, "ts">();
+    EXPECT_THROW((trades.join<Join::AsOf, "symbol", "ts">(unsorted_quotes)), JoinException);
+}
+
 std::vector<std::string> getLines (std::stringstream& sstr) {
     std::string line;
     std::vector<std::string> lines;
@@ -288,6 +598,413 @@ TEST(DataFrame, GroupBy) {
     EXPECT_THAT(summarize_group_by_two_columns.getColumn<"d_false">(), ::testing::ElementsAre(0, 2));
 }
 
+TEST(DataFrame, GroupByParallel) {
+    DataFrame<
+        Column<"key", int>,
+        Column<"value", long>,
+        Column<"amount", double>,
+        Column<"flag", bool>
+    > testdf;
+    for (long i = 0; i < 100'000; ++i) {
+        testdf.insert(static_cast<int>((i * 7919) % 1'000), i, 0.5 * (i % 17), i % 3 == 0);
+    }
+
+    auto summarize = [&](std::size_t num_threads) {
+        return testdf.summarize<
+            GroupBy<"key">,
+            Sum<"value", "value_sum">,
+            Min<"value", "value_min">,
+            Max<"value", "value_max">,
+            Avg<"amount", "amount_avg">,
+            StdDev<"amount", "amount_stddev">,
+            CountIf<"flag", "flag_true">,
+            CountIfNot<"flag", "flag_false">
+        >({.num_threads = num_threads});
+    };
+    auto serial = summarize(1);
+    auto parallel = summarize(4);
+
+    ASSERT_EQ(parallel.getSize(), 1'000);
+    EXPECT_EQ(parallel.getColumn<"key">(), serial.getColumn<"key">());
+    EXPECT_EQ(parallel.getColumn<"value_sum">(), serial.getColumn<"value_sum">());
+    EXPECT_EQ(parallel.getColumn<"value_min">(), serial.getColumn<"value_min">());
+    EXPECT_EQ(parallel.getColumn<"value_max">(), serial.getColumn<"value_max">());
+    EXPECT_EQ(parallel.getColumn<"flag_true">(), serial.getColumn<"flag_true">());
+    EXPECT_EQ(parallel.getColumn<"flag_false">(), serial.getColumn<"flag_false">());
+    EXPECT_EQ(parallel.getColumn<"amount_avg">(), serial.getColumn<"amount_avg">());
+    EXPECT_EQ(parallel.getColumn<"amount_stddev">(), serial.getColumn<"amount_stddev">());
+
+    auto serial_no_group_by = testdf.summarize<GroupByNone, Sum<"value", "value_sum">, Avg<"amount", "amount_avg">>();
+    auto parallel_no_group_by = testdf.summarize<GroupByNone, Sum<"value", "value_sum">, Avg<"amount", "amount_avg">>({.num_threads = 3});
+    EXPECT_EQ(parallel_no_group_by.getColumn<"value_sum">(), serial_no_group_by.getColumn<"value_sum">());
+    EXPECT_EQ(parallel_no_group_by.getColumn<"amount_avg">(), serial_no_group_by.getColumn<"amount_avg">());
+}
+
+TEST(DataFrame, SummarizeParallelIsBitIdentical) {
+    DataFrame<Column<"key", int>, Column<"x", double>> testdf;
+    // spans multiple blocks, with values of different magnitudes such that the rounding depends on the order
+    for (auto i = 0; i < 1'000'000; ++i) {
+        testdf.insert(i % 7, (i % 2 == 0 ? 1.0 : -1.0) * (1e8 / (i + 1) + 0.1 * (i % 10)));
+    }
+
+    auto serial = testdf.summarize<GroupBy<"key">, Sum<"x", "x_sum">, Avg<"x", "x_avg">>({.num_threads = 1});
+    auto parallel = testdf.summarize<GroupBy<"key">, Sum<"x", "x_sum">, Avg<"x", "x_avg">>({.num_threads = 4});
+    EXPECT_EQ(parallel.getColumn<"x_sum">(), serial.getColumn<"x_sum">());
+    EXPECT_EQ(parallel.getColumn<"x_avg">(), serial.getColumn<"x_avg">());
+
+    auto serial_no_group_by = testdf.summarize<GroupByNone, Sum<"x", "x_sum">>({.num_threads = 1});
+    auto parallel_no_group_by = testdf.summarize<GroupByNone, Sum<"x", "x_sum">>({.num_threads = 4});
+    EXPECT_EQ(parallel_no_group_by.getColumn<"x_sum">(), serial_no_group_by.getColumn<"x_sum">());
+}
+
+TEST(DataFrame, SummarizeBoolColumnWithoutGroupBy) {
+    DataFrame<Column<"b", bool>> testdf;
+    for (int i = 0; i < 100; ++i) {
+        testdf.insert(i % 4 == 0);
+    }
+
+    // std::vector<bool> has no contiguous storage: the column is summarized row by row
+    EXPECT_EQ((testdf.summarize<GroupByNone, Sum<"b", "s">>().getColumn<"s">()[0]), true);
+    EXPECT_EQ((testdf.summarize<GroupByNone, Min<"b", "mn">>().getColumn<"mn">()[0]), false);
+    EXPECT_EQ((testdf.summarize<GroupByNone, Max<"b", "mx">>().getColumn<"mx">()[0]), true);
+    EXPECT_DOUBLE_EQ((testdf.summarize<GroupByNone, Avg<"b", "a">>().getColumn<"a">()[0]), 0.25);
+
+    auto fused = testdf.summarize<GroupByNone, Sum<"b", "s">, Max<"b", "mx">, Avg<"b", "a">>();
+    EXPECT_EQ(fused.getColumn<"s">()[0], true);
+    EXPECT_EQ(fused.getColumn<"mx">()[0], true);
+    EXPECT_DOUBLE_EQ(fused.getColumn<"a">()[0], 0.25);
+}
+
+TEST(DataFrame, SummarizeFusedOps) {
+    DataFrame<
+        Column<"city", int>,
+        Column<"x", double>
+    > testdf;
+    for (int i = 0; i < 50'000; ++i) {
+        testdf.insert(i % 7, 0.25 * ((i * 31) % 101) - 3.0);
+    }
+
+    for (std::size_t num_threads : {1, 4}) {
+        auto fused = testdf.summarize<
+            GroupBy<"city">,
+            Sum<"x", "s">,
+            Avg<"x", "a">,
+            StdDev<"x", "sd">,
+            Min<"x", "mn">
+        >({.num_threads = num_threads});
+        auto sum = testdf.summarize<GroupBy<"city">, Sum<"x", "s">>({.num_threads = num_threads});
+        auto avg = testdf.summarize<GroupBy<"city">, Avg<"x", "a">>({.num_threads = num_threads});
+        auto stddev = testdf.summarize<GroupBy<"city">, StdDev<"x", "sd">>({.num_threads = num_threads});
+        auto min = testdf.summarize<GroupBy<"city">, Min<"x", "mn">>({.num_threads = num_threads});
+
+        ASSERT_EQ(fused.getSize(), 7);
+        EXPECT_EQ(fused.getColumn<"city">(), sum.getColumn<"city">());
+        EXPECT_EQ(fused.getColumn<"mn">(), min.getColumn<"mn">());
+        for (auto i = 0LU; i < fused.getSize(); ++i) {
+            EXPECT_NEAR(fused.getColumn<"s">()[i], sum.getColumn<"s">()[i], 1e-6);
+            EXPECT_NEAR(fused.getColumn<"a">()[i], avg.getColumn<"a">()[i], 1e-9);
+            EXPECT_NEAR(fused.getColumn<"sd">()[i], stddev.getColumn<"sd">()[i], 1e-9);
+        }
+    }
+}
+
+TEST(DataFrame, GroupBySortedRuns) {
+    DataFrame<Column<"key", int>, Column<"sub", char>, Column<"value", long>> testdf;
+    for (long i = 0; i < 100'000; ++i) {
+        testdf.insert(static_cast<int>((i * 7919) % 997), static_cast<char>('a' + i % 3), i);
+    }
+    auto sorted_df = testdf.sort<SortOrder::Ascending, "key", "sub">();
+
+    auto summarize = [&](SummarizeStrategy strategy, std::size_t num_threads) {
+        return sorted_df.summarize<
+            GroupBy<"key", "sub">,
+            Sum<"value", "value_sum">,
+            Max<"value", "value_max">
+        >({.num_threads = num_threads, .strategy = strategy});
+    };
+    auto hash_result = summarize(SummarizeStrategy::Hash, 1);
+    auto runs_result = summarize(SummarizeStrategy::SortedRuns, 1);
+    auto parallel_runs_result = summarize(SummarizeStrategy::SortedRuns, 4);
+
+    ASSERT_EQ(runs_result.getSize(), 997 * 3);
+    EXPECT_EQ(runs_result.getColumn<"key">(), hash_result.getColumn<"key">());
+    EXPECT_EQ(runs_result.getColumn<"sub">(), hash_result.getColumn<"sub">());
+    EXPECT_EQ(runs_result.getColumn<"value_sum">(), hash_result.getColumn<"value_sum">());
+    EXPECT_EQ(parallel_runs_result.getColumn<"key">(), hash_result.getColumn<"key">());
+    EXPECT_EQ(parallel_runs_result.getColumn<"value_sum">(), hash_result.getColumn<"value_sum">());
+    EXPECT_EQ(parallel_runs_result.getColumn<"value_max">(), hash_result.getColumn<"value_max">());
+
+    EXPECT_THROW(
+        (testdf.summarize<GroupBy<"key">, Sum<"value", "value_sum">>({.strategy = SummarizeStrategy::SortedRuns})),
+        SummarizeException
+    );
+}
+
+enum class OrderStatus { Open = 0, Shipped, Delivered, Cancelled };
+
+TEST(DataFrame, GroupByKeyDomain) {
+    DataFrame<
+        Column<"flag", bool>,
+        Column<"grade", char>,
+        Column<"status", OrderStatus>,
+        Column<"bucket", int>,
+        Column<"value", long>
+    > testdf;
+    for (long i = 0; i < 50'000; ++i) {
+        testdf.insert(i % 3 == 0, static_cast<char>('A' + i % 5), static_cast<OrderStatus>(i % 4), static_cast<int>(i % 16), i);
+    }
+
+    auto by_flag = testdf.summarize<GroupBy<"flag">, Sum<"value", "value_sum">>({.num_threads = 4});
+    ASSERT_EQ(by_flag.getSize(), 2);
+    EXPECT_THAT(by_flag.getColumn<"flag">(), ::testing::ElementsAre(true, false));
+    EXPECT_EQ(by_flag.getColumn<"value_sum">()[0] + by_flag.getColumn<"value_sum">()[1], 49'999L * 50'000L / 2);
+
+    auto by_grade = testdf.summarize<GroupBy<"grade">, Sum<"value", "value_sum">>();
+    EXPECT_THAT(by_grade.getColumn<"grade">(), ::testing::ElementsAre('A', 'B', 'C', 'D', 'E'));
+
+    auto by_status = testdf.summarize<GroupByDomain<"status", 0, 4>, Max<"value", "value_max">>({.num_threads = 2});
+    EXPECT_THAT(by_status.getColumn<"status">(), ::testing::ElementsAre(OrderStatus::Open, OrderStatus::Shipped, OrderStatus::Delivered, OrderStatus::Cancelled));
+    EXPECT_THAT(by_status.getColumn<"value_max">(), ::testing::ElementsAre(49'996, 49'997, 49'998, 49'999));
+
+    auto by_bucket = testdf.summarize<GroupByDomain<"bucket", 0, 16>, Sum<"value", "value_sum">>();
+    auto by_bucket_hash = testdf.summarize<GroupBy<"bucket">, Sum<"value", "value_sum">>();
+    EXPECT_EQ(by_bucket.getColumn<"bucket">(), by_bucket_hash.getColumn<"bucket">());
+    EXPECT_EQ(by_bucket.getColumn<"value_sum">(), by_bucket_hash.getColumn<"value_sum">());
+
+    EXPECT_THROW((testdf.summarize<GroupByDomain<"bucket", 0, 8>, Sum<"value", "value_sum">>()), SummarizeException);
+}
+
+TEST(DataFrame, MaterializedSummary) {
+    DataFrame<
+        Column<"city", std::string>,
+        Column<"x", double>,
+        Column<"flag", bool>
+    > testdf;
+    testdf.insert("Berlin", 1.0, true);
+    testdf.insert("Paris", 2.0, false);
+    testdf.insert("Berlin", 3.0, false);
+
+    auto summary = testdf.materializeSummary<
+        GroupBy<"city">,
+        Sum<"x", "x_sum">,
+        Avg<"x", "x_avg">,
+        StdDev<"x", "x_stddev">,
+        Min<"x", "x_min">,
+        Max<"x", "x_max">,
+        CountIf<"flag", "flag_cnt">
+    >();
+    EXPECT_EQ(summary.getNumRows(), 3);
+    auto result = summary.getResult();
+    EXPECT_THAT(result.getColumn<"city">(), ::testing::ElementsAre("Berlin", "Paris"));
+    EXPECT_THAT(result.getColumn<"x_sum">(), ::testing::ElementsAre(4.0, 2.0));
+
+    // appended rows are summarized on the next refresh only
+    testdf.insert("Rome", 7.0, true);
+    testdf.insert("Paris", 4.0, true);
+    EXPECT_EQ(summary.getResult().getSize(), 2);
+    summary.refresh();
+    EXPECT_EQ(summary.getNumRows(), 5);
+
+    std::vector<std::string> cities{"Rome", "Berlin", "Tokyo"};
+    std::vector<double> values(60'000);
+    for (auto i = 0LU; i < values.size(); ++i) {
+        testdf.insert(cities[i % 3], 0.5 * (i % 13), i % 2 == 0);
+    }
+    summary.refresh();
+    summary.refresh();
+
+    auto incremental = summary.getResult();
+    auto full = testdf.summarize<
+        GroupBy<"city">,
+        Sum<"x", "x_sum">,
+        Avg<"x", "x_avg">,
+        StdDev<"x", "x_stddev">,
+        Min<"x", "x_min">,
+        Max<"x", "x_max">,
+        CountIf<"flag", "flag_cnt">
+    >();
+    EXPECT_TRUE((std::is_same_v<decltype(incremental), decltype(full)>));
+    EXPECT_THAT(incremental.getColumn<"city">(), ::testing::ElementsAre("Berlin", "Paris", "Rome", "Tokyo"));
+    EXPECT_EQ(incremental.getColumn<"x_sum">(), full.getColumn<"x_sum">());
+    EXPECT_EQ(incremental.getColumn<"x_min">(), full.getColumn<"x_min">());
+    EXPECT_EQ(incremental.getColumn<"x_max">(), full.getColumn<"x_max">());
+    EXPECT_EQ(incremental.getColumn<"flag_cnt">(), full.getColumn<"flag_cnt">());
+    for (auto i = 0LU; i < incremental.getSize(); ++i) {
+        EXPECT_NEAR(incremental.getColumn<"x_avg">()[i], full.getColumn<"x_avg">()[i], 1e-9);
+        EXPECT_NEAR(incremental.getColumn<"x_stddev">()[i], full.getColumn<"x_stddev">()[i], 1e-9);
+    }
+
+    auto total = testdf.materializeSummary<GroupByNone, Sum<"x", "x_sum">, CountIfNot<"flag", "flag_cnt">>({.num_threads = 4});
+    testdf.insert("Oslo", 100.0, false);
+    total.refresh();
+    EXPECT_EQ(total.getResult().getColumn<"x_sum">()[0], (testdf.summarize<GroupByNone, Sum<"x", "x_sum">>().getColumn<"x_sum">()[0]));
+    EXPECT_EQ(total.getResult().getColumn<"flag_cnt">()[0], 30'003);
+
+    EXPECT_THROW((testdf.materializeSummary<GroupBy<"city">, Sum<"x", "x_sum">>({.strategy = SummarizeStrategy::SortedRuns})), SummarizeException);
+    auto can_materialize_exact_median = [](const auto& df) {
+        return requires { df.template materializeSummary<GroupBy<"city">, ExactMedian<"x", "x_median">>(); };
+    };
+    EXPECT_FALSE(can_materialize_exact_median(testdf));
+}
+
+TEST(DataFrame, SummarizeCountDistinctApprox) {
+    DataFrame<Column<"region", std::string>, Column<"user_id", int>> testdf;
+    for (auto i = 0; i < 20'000; ++i) {
+        // region "north" has 5000 distinct users, region "south" has 500
+        if (i % 2 == 0) {
+            testdf.insert("north", (i / 2) % 5'000);
+        }
+        else {
+            testdf.insert("south", (i / 2) % 500);
+        }
+    }
+
+    auto result = testdf.summarize<
+        GroupBy<"region">,
+        CountDistinctApprox<"user_id", "uniq_users">,
+        CountDistinctApprox<"user_id", "uniq_users_coarse", 8>
+    >({.num_threads = 2});
+    ASSERT_EQ(result.getSize(), 2);
+    EXPECT_EQ(result.getColumn<"region">()[0], "north");
+    EXPECT_NEAR(result.getColumn<"uniq_users">()[0], 5'000, 250);
+    EXPECT_NEAR(result.getColumn<"uniq_users">()[1], 500, 25);
+    EXPECT_NEAR(result.getColumn<"uniq_users_coarse">()[0], 5'000, 1'000);
+}
+
+TEST(DataFrame, SummarizeQuantile) {
+    DataFrame<Column<"endpoint", std::string>, Column<"latency_ms", double>> testdf;
+    for (auto i = 0; i < 50'000; ++i) {
+        testdf.insert("/users", static_cast<double>(i % 1'000));
+        testdf.insert("/orders", 10.0 * (i % 1'000));
+    }
+
+    auto result = testdf.summarize<
+        GroupBy<"endpoint">,
+        Median<"latency_ms", "p50">,
+        Quantile<"latency_ms", "p99", 99>
+    >({.num_threads = 4});
+    ASSERT_EQ(result.getSize(), 2);
+    EXPECT_EQ(result.getColumn<"endpoint">()[0], "/users");
+    EXPECT_NEAR(result.getColumn<"p50">()[0], 500.0, 10.0);
+    EXPECT_NEAR(result.getColumn<"p99">()[0], 990.0, 2.0);
+    EXPECT_NEAR(result.getColumn<"p50">()[1], 5'000.0, 100.0);
+    EXPECT_NEAR(result.getColumn<"p99">()[1], 9'900.0, 20.0);
+}
+
+TEST(DataFrame, SummarizeExactQuantile) {
+    DataFrame<Column<"endpoint", std::string>, Column<"latency_ms", int>> testdf;
+    for (auto i = 0; i < 40'001; ++i) {
+        testdf.insert(i % 2 == 0 ? "/users" : "/orders", (i * 7919) % 40'001);
+    }
+
+    auto summarize = [&](std::size_t num_threads) {
+        return testdf.summarize<
+            GroupBy<"endpoint">,
+            ExactMedian<"latency_ms", "p50">,
+            ExactQuantile<"latency_ms", "p99", 99>
+        >({.num_threads = num_threads});
+    };
+    auto serial = summarize(1);
+    auto parallel = summarize(2);
+
+    std::vector<int> users{};
+    for (auto i = 0; i < 40'001; i += 2) {
+        users.push_back((i * 7919) % 40'001);
+    }
+    std::sort(users.begin(), users.end());
+    ASSERT_EQ(serial.getSize(), 2);
+    EXPECT_EQ(serial.getColumn<"endpoint">()[0], "/users");
+    EXPECT_DOUBLE_EQ(serial.getColumn<"p50">()[0], users[10'000]);
+    EXPECT_DOUBLE_EQ(serial.getColumn<"p99">()[0], users[19'800]);
+    EXPECT_EQ(parallel.getColumn<"p50">(), serial.getColumn<"p50">());
+    EXPECT_EQ(parallel.getColumn<"p99">(), serial.getColumn<"p99">());
+}
+
+TEST(DataFrame, SummarizeRollup) {
+    DataFrame<Column<"region", std::string>, Column<"city", int>, Column<"sales", int>> testdf;
+    for (auto i = 0; i < 50'000; ++i) {
+        testdf.insert(i % 2 == 0 ? "north" : "south", i % 6, i % 100);
+    }
+
+    auto rollup = [&](std::size_t num_threads) {
+        return testdf.summarize<Rollup<"region", "city">, Sum<"sales", "total">, Max<"sales", "max">>({.num_threads = num_threads});
+    };
+    auto serial = rollup(1);
+    auto parallel = rollup(4);
+
+    // the finest groups, the regions and the grand total in the order of the sets
+    auto by_city = testdf.summarize<GroupBy<"region", "city">, Sum<"sales", "total">>();
+    auto by_region = testdf.summarize<GroupBy<"region">, Sum<"sales", "total">>();
+    ASSERT_EQ(serial.getSize(), by_city.getSize() + by_region.getSize() + 1);
+    EXPECT_THAT(serial.getColumn<"grouping_set">(), ::testing::ElementsAre(0, 0, 0, 0, 0, 0, 1, 1, 2));
+    for (auto i = 0LU; i < by_city.getSize(); ++i) {
+        EXPECT_EQ(serial.getColumn<"region">()[i], by_city.getColumn<"region">()[i]);
+        EXPECT_EQ(serial.getColumn<"city">()[i], by_city.getColumn<"city">()[i]);
+        EXPECT_EQ(serial.getColumn<"total">()[i], by_city.getColumn<"total">()[i]);
+    }
+    EXPECT_THAT(std::vector<std::string>(serial.getColumn<"region">().begin() + 6, serial.getColumn<"region">().end()), ::testing::ElementsAre("north", "south", ""));
+    EXPECT_THAT(std::vector<int>(serial.getColumn<"city">().begin() + 6, serial.getColumn<"city">().end()), ::testing::ElementsAre(0, 0, 0));
+    EXPECT_EQ(serial.getColumn<"total">()[6], by_region.getColumn<"total">()[0]);
+    EXPECT_EQ(serial.getColumn<"total">()[7], by_region.getColumn<"total">()[1]);
+    EXPECT_EQ(serial.getColumn<"total">()[8], 50'000 / 100 * 4'950);
+    EXPECT_EQ(serial.getColumn<"max">()[8], 99);
+
+    EXPECT_EQ(parallel.getColumn<"grouping_set">(), serial.getColumn<"grouping_set">());
+    EXPECT_EQ(parallel.getColumn<"total">(), serial.getColumn<"total">());
+}
+
+TEST(DataFrame, SummarizeGroupingSets) {
+    DataFrame<Column<"region", std::string>, Column<"city", int>, Column<"sales", double>> testdf;
+    testdf.insert("north", 1, 1.0);
+    testdf.insert("south", 1, 2.0);
+    testdf.insert("north", 2, 4.0);
+
+    auto df = testdf.summarize<GroupingSets<GroupBy<"city">, GroupBy<"region">>, Avg<"sales", "avg">, ExactMedian<"sales", "median">>();
+    ASSERT_EQ(df.getSize(), 4);
+    EXPECT_THAT(df.getColumn<"city">(), ::testing::ElementsAre(1, 2, 0, 0));
+    EXPECT_THAT(df.getColumn<"region">(), ::testing::ElementsAre("", "", "north", "south"));
+    EXPECT_THAT(df.getColumn<"grouping_set">(), ::testing::ElementsAre(0, 0, 1, 1));
+    EXPECT_THAT(df.getColumn<"avg">(), ::testing::ElementsAre(1.5, 4.0, 2.5, 2.0));
+    EXPECT_THAT(df.getColumn<"median">(), ::testing::ElementsAre(1.5, 4.0, 2.5, 2.0));
+
+    // the grand total of an empty DataFrame has a group, as summarize with GroupByNone
+    DataFrame<Column<"region", std::string>, Column<"sales", double>> emptydf;
+    auto df_empty = emptydf.summarize<Rollup<"region">, Sum<"sales", "total">>();
+    ASSERT_EQ(df_empty.getSize(), 1);
+    EXPECT_EQ(df_empty.getColumn<"grouping_set">()[0], 1);
+    EXPECT_EQ(df_empty.getColumn<"total">()[0], 0.0);
+}
+
+TEST(DataFrame, TopKPerGroup) {
+    DataFrame<Column<"user", std::string>, Column<"amount", int>> testdf;
+    for (auto i = 0; i < 10'000; ++i) {
+        testdf.insert(i % 3 == 0 ? "alice" : "bob", (i * 7919) % 10'007);
+    }
+
+    auto top_k = [&](std::size_t num_threads) {
+        return testdf.topKPerGroup<GroupBy<"user">, "amount", 3>({.num_threads = num_threads});
+    };
+    auto serial = top_k(1);
+    auto parallel = top_k(4);
+
+    std::vector<int> alice{};
+    for (auto i = 0; i < 10'000; i += 3) {
+        alice.push_back((i * 7919) % 10'007);
+    }
+    std::sort(alice.begin(), alice.end(), std::greater<int>{});
+    ASSERT_EQ(serial.getSize(), 6);
+    EXPECT_THAT(serial.getColumn<"user">(), ::testing::ElementsAre("alice", "alice", "alice", "bob", "bob", "bob"));
+    EXPECT_THAT(std::vector<int>(serial.getColumn<"amount">().begin(), serial.getColumn<"amount">().begin() + 3), ::testing::ElementsAre(alice[0], alice[1], alice[2]));
+    EXPECT_EQ(parallel.getColumn<"user">(), serial.getColumn<"user">());
+    EXPECT_EQ(parallel.getColumn<"amount">(), serial.getColumn<"amount">());
+
+    std::vector<int> amounts = testdf.getColumn<"amount">();
+    std::sort(amounts.begin(), amounts.end());
+    auto smallest = testdf.topKPerGroup<GroupBy<>, "amount", 2, SortOrder::Ascending>();
+    ASSERT_EQ(smallest.getSize(), 2);
+    EXPECT_THAT(smallest.getColumn<"amount">(), ::testing::ElementsAre(amounts[0], amounts[1]));
+}
+
 struct MyData {
     int a;
     char b;
@@ -299,6 +1016,82 @@ std::ostream& operator<< (std::ostream& stream, const MyData& data) {
     return stream;
 }
 
+TEST(DataFrame, Rolling) {
+    DataFrame<
+        Column<"sensor", std::string>,
+        Column<"v", double>,
+        Column<"alarm", bool>
+    > testdf;
+    testdf.insert("a", 1.0, false);
+    testdf.insert("b", 10.0, true);
+    testdf.insert("a", 3.0, true);
+    testdf.insert("a", 2.0, false);
+    testdf.insert("b", 20.0, true);
+    testdf.insert("a", 6.0, true);
+
+    auto dfrolling = testdf.rolling<Window<3>, Sum<"v", "v_sum">, Max<"v", "v_max">>();
+    EXPECT_TRUE((std::is_same_v<decltype(dfrolling), DataFrame<
+        Column<"sensor", std::string>,
+        Column<"v", double>,
+        Column<"alarm", bool>,
+        Column<"v_sum", double>,
+        Column<"v_max", double>
+    >>));
+    EXPECT_THAT(dfrolling.getColumn<"sensor">(), ::testing::ElementsAre("a", "b", "a", "a", "b", "a"));
+    EXPECT_THAT(dfrolling.getColumn<"v_sum">(), ::testing::ElementsAre(1.0, 11.0, 14.0, 15.0, 25.0, 28.0));
+    EXPECT_THAT(dfrolling.getColumn<"v_max">(), ::testing::ElementsAre(1.0, 10.0, 10.0, 10.0, 20.0, 20.0));
+
+    auto dfpartitioned = testdf.rolling<
+        Window<2, "sensor">,
+        Avg<"v", "v_avg">,
+        Min<"v", "v_min">,
+        CountIf<"alarm", "alarms">
+    >();
+    EXPECT_THAT(dfpartitioned.getColumn<"v_avg">(), ::testing::ElementsAre(1.0, 10.0, 2.0, 2.5, 15.0, 4.0));
+    EXPECT_THAT(dfpartitioned.getColumn<"v_min">(), ::testing::ElementsAre(1.0, 10.0, 1.0, 2.0, 10.0, 2.0));
+    EXPECT_THAT(dfpartitioned.getColumn<"alarms">(), ::testing::ElementsAre(0, 1, 1, 1, 2, 1));
+}
+
+TEST(DataFrame, Window) {
+    DataFrame<
+        Column<"user", std::string>,
+        Column<"ts", int>,
+        Column<"price", double>,
+        Column<"qty", int>
+    > testdf;
+    testdf.insert("bob", 3, 12.0, 1);
+    testdf.insert("amy", 2, 5.0, 4);
+    testdf.insert("bob", 1, 10.0, 2);
+    testdf.insert("amy", 1, 4.0, 3);
+    testdf.insert("bob", 2, 11.0, 5);
+
+    auto dfwindow = testdf.window<
+        PartitionBy<"user">,
+        OrderBy<"ts">,
+        RowNumber<"rn">,
+        Lag<"price", "prev_price">,
+        CumSum<"qty", "cum_qty">
+    >();
+    EXPECT_TRUE((std::is_same_v<decltype(dfwindow), DataFrame<
+        Column<"user", std::string>,
+        Column<"ts", int>,
+        Column<"price", double>,
+        Column<"qty", int>,
+        Column<"rn", std::size_t>,
+        Column<"prev_price", double>,
+        Column<"cum_qty", int>
+    >>));
+    EXPECT_THAT(dfwindow.getColumn<"ts">(), ::testing::ElementsAre(3, 2, 1, 1, 2));
+    EXPECT_THAT(dfwindow.getColumn<"rn">(), ::testing::ElementsAre(3, 2, 1, 1, 2));
+    EXPECT_THAT(dfwindow.getColumn<"prev_price">(), ::testing::ElementsAre(11.0, 4.0, 0.0, 0.0, 10.0));
+    EXPECT_THAT(dfwindow.getColumn<"cum_qty">(), ::testing::ElementsAre(8, 7, 2, 3, 7));
+
+    auto dfranked = testdf.window<PartitionBy<>, OrderByDescending<"ts">, Rank<"rank">, DenseRank<"dense_rank">, Lead<"user", "next_user">>();
+    EXPECT_THAT(dfranked.getColumn<"rank">(), ::testing::ElementsAre(1, 2, 4, 4, 2));
+    EXPECT_THAT(dfranked.getColumn<"dense_rank">(), ::testing::ElementsAre(1, 2, 3, 3, 2));
+    EXPECT_THAT(dfranked.getColumn<"next_user">(), ::testing::ElementsAre("amy", "bob", "amy", "", "bob"));
+}
+
 TEST(DataFrame, Print) {
     DataFrame<
         Column<"a", int>,
@@ -0,0 +1,163 @@
+// Copyright 2022 Andi Hellmund
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <cstdlib>
+#include <new>
+#include <string>
+
+#include "data_crunching/dataframe.hpp"
+
+// counts all allocations of this test binary: the replacement affects the whole program,
+// which is why these tests are kept separate from the other DataFrame tests
+static std::size_t num_allocations = 0;
+
+void* operator new (std::size_t size) {
+    ++num_allocations;
+    if (void* memory = std::malloc(size == 0 ? 1 : size)) {
+        return memory;
+    }
+    throw std::bad_alloc{};
+}
+
+void operator delete (void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete (void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+using namespace dacr;
+
+template <typename Func>
+std::size_t countAllocations (Func&& func) {
+    const auto num_allocations_before = num_allocations;
+    func();
+    return num_allocations - num_allocations_before;
+}
+
+using DataFrameLeft = DataFrame<
+    Column<"id", int>,
+    Column<"value", double>,
+    Column<"flag", bool>
+>;
+
+using DataFrameRight = DataFrame<
+    Column<"id", int>,
+    Column<"other_value", double>
+>;
+
+void fillDataFrames (DataFrameLeft& df_left, DataFrameRight& df_right) {
+    for (int i = 0; i < 10'000; ++i) {
+        df_left.insert(i % 2'000, 1.0 * i, i % 2 == 0);
+    }
+    for (int i = 0; i < 1'000; ++i) {
+        df_right.insert(i * 2, 0.5 * i);
+        df_right.insert(i * 2, 0.25 * i);
+    }
+}
+
+TEST(DataFrameAllocation, MaterializeAllocatesEachColumnOnce) {
+    DataFrameLeft df_left{};
+    DataFrameRight df_right{};
+    fillDataFrames(df_left, df_right);
+
+    auto joined_rows = df_left.joinRows<Join::Inner, "id">(df_right);
+    ASSERT_EQ(joined_rows.getSize(), 10'000);
+
+    DataFrame<Column<"id", int>, Column<"value", double>, Column<"flag", bool>, Column<"other_value", double>> dfjoined{};
+    EXPECT_EQ(countAllocations([&]() { dfjoined = joined_rows.materialize(); }), 4);
+
+    DataFrame<Column<"other_value", double>, Column<"flag", bool>> dfselected{};
+    EXPECT_EQ(countAllocations([&]() { dfselected = joined_rows.materialize<"other_value", "flag">(); }), 2);
+}
+
+TEST(DataFrameAllocation, JoinReservesExactCapacity) {
+    DataFrameLeft df_left{};
+    DataFrameRight df_right{};
+    fillDataFrames(df_left, df_right);
+
+    for (auto strategy : {JoinStrategy::Hash, JoinStrategy::PartitionedHash}) {
+        auto joined_rows = df_left.joinRows<Join::Inner, "id">(df_right, {.strategy = strategy, .num_threads = 2});
+        EXPECT_EQ(joined_rows.getLeftRowIndices().capacity(), joined_rows.getSize());
+        EXPECT_EQ(joined_rows.getRightRowIndices().capacity(), joined_rows.getSize());
+
+        auto dfjoined = joined_rows.materialize();
+        EXPECT_EQ(dfjoined.getColumn<"id">().capacity(), dfjoined.getSize());
+        EXPECT_EQ(dfjoined.getColumn<"value">().capacity(), dfjoined.getSize());
+        EXPECT_EQ(dfjoined.getColumn<"other_value">().capacity(), dfjoined.getSize());
+    }
+
+    auto dfsemi = df_left.join<Join::Semi, "id">(df_right);
+    EXPECT_EQ(dfsemi.getSize(), 5'000);
+    EXPECT_EQ(dfsemi.getColumn<"id">().capacity(), dfsemi.getSize());
+    EXPECT_EQ(dfsemi.getColumn<"value">().capacity(), dfsemi.getSize());
+}
+
+TEST(DataFrameAllocation, SummarizeReservesExactCapacity) {
+    DataFrame<Column<"name", std::string>, Column<"value", int>> testdf{};
+    for (int i = 0; i < 10'000; ++i) {
+        testdf.insert("a long group name that is allocated " + std::to_string(i % 3'000), i);
+    }
+
+    for (auto strategy : {SummarizeStrategy::Hash, SummarizeStrategy::SortedRuns}) {
+        auto sorted_df = testdf.sort<SortOrder::Ascending, "name">();
+        auto dfsummarized = sorted_df.summarize<GroupBy<"name">, Sum<"value", "sum">, Max<"value", "max">>({.strategy = strategy});
+        ASSERT_EQ(dfsummarized.getSize(), 3'000);
+        EXPECT_EQ(dfsummarized.getColumn<"name">().capacity(), dfsummarized.getSize());
+        EXPECT_EQ(dfsummarized.getColumn<"sum">().capacity(), dfsummarized.getSize());
+        EXPECT_EQ(dfsummarized.getColumn<"max">().capacity(), dfsummarized.getSize());
+    }
+
+    auto dfrollup = testdf.summarize<Rollup<"name">, Sum<"value", "sum">>();
+    ASSERT_EQ(dfrollup.getSize(), 3'001);
+    EXPECT_EQ(dfrollup.getColumn<"name">().capacity(), dfrollup.getSize());
+    EXPECT_EQ(dfrollup.getColumn<"grouping_set">().capacity(), dfrollup.getSize());
+    EXPECT_EQ(dfrollup.getColumn<"sum">().capacity(), dfrollup.getSize());
+}
+
+TEST(DataFrameAllocation, SummarizeMovesGroupByValues) {
+    DataFrame<Column<"name", std::string>, Column<"value", int>> testdf{};
+    for (int i = 0; i < 1'000; ++i) {
+        testdf.insert("a long group name that is allocated " + std::to_string(i), i);
+    }
+
+    // one allocation per group for the copy of the name into the group, none for the result
+    const auto num_allocations_summarize = countAllocations([&]() {
+        (void)testdf.summarize<GroupBy<"name">, Sum<"value", "sum">>();
+    });
+    EXPECT_LT(num_allocations_summarize, 2 * 1'000);
+}
+
+TEST(DataFrameAllocation, MaterializedSummaryRefreshOfKeyDomain) {
+    DataFrame<Column<"key", int>, Column<"value", double>> testdf{};
+    for (int i = 0; i < 100; ++i) {
+        testdf.insert(i * 1'000, 1.0 * i);
+    }
+    auto summary = testdf.materializeSummary<GroupByDomain<"key", 0, (1 << 24)>, Sum<"value", "sum">>();
+    for (int i = 0; i < 10; ++i) {
+        testdf.insert(i * 1'000, 1.0);
+    }
+
+    // rows of existing groups are summarized into the summary without any flat array over the domain
+    const auto num_allocations_refresh = countAllocations([&]() {
+        summary.refresh();
+    });
+    EXPECT_EQ(num_allocations_refresh, 0);
+    EXPECT_EQ(summary.getNumRows(), 110);
+    EXPECT_DOUBLE_EQ(summary.getResult().getColumn<"sum">()[1], 2.0);
+}
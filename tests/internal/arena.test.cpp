@@ -0,0 +1,72 @@
+// Copyright 2022 Andi Hellmund
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <vector>
+
+#include "data_crunching/internal/arena.hpp"
+
+using namespace dacr;
+using namespace dacr::internal;
+
+TEST(ValueArena, Allocate) {
+    ValueArena<int> arena{};
+    EXPECT_EQ(arena.getNumBlocks(), 0);
+
+    std::vector<int*> arrays{};
+    for (auto i = 0; i < 1000; ++i) {
+        arrays.push_back(arena.allocate(4));
+        for (auto j = 0; j < 4; ++j) {
+            arrays.back()[j] = 4 * i + j;
+        }
+    }
+    // the arrays are carved from a single block and do not overlap
+    EXPECT_EQ(arena.getNumBlocks(), 1);
+    for (auto i = 0; i < 1000; ++i) {
+        for (auto j = 0; j < 4; ++j) {
+            EXPECT_EQ(arrays[i][j], 4 * i + j);
+        }
+    }
+}
+
+TEST(ValueArena, GeometricBlocks) {
+    ValueArena<double> arena{};
+    for (auto i = 0; i < 1'000'000; ++i) {
+        arena.allocate(1);
+    }
+    EXPECT_LE(arena.getNumBlocks(), 10);
+
+    // arrays larger than a block get a block of their own
+    double* large = arena.allocate(10'000'000);
+    large[9'999'999] = 1.0;
+    EXPECT_DOUBLE_EQ(large[9'999'999], 1.0);
+}
+
+TEST(ValueArena, Extend) {
+    ValueArena<int> arena{};
+    int* first = arena.allocate(4);
+    EXPECT_TRUE(arena.extend(first, 4, 8));
+
+    // only the most recent array grows in place
+    int* second = arena.allocate(4);
+    EXPECT_EQ(second, first + 8);
+    EXPECT_FALSE(arena.extend(first, 8, 16));
+    EXPECT_TRUE(arena.extend(second, 4, 16));
+
+    // not beyond the current block
+    EXPECT_FALSE(arena.extend(second, 16, 1'000'000));
+    EXPECT_EQ(arena.getNumBlocks(), 1);
+}
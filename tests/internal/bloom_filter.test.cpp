@@ -0,0 +1,53 @@
+// Copyright 2022 Andi Hellmund
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <cstdint>
+
+#include "data_crunching/internal/bloom_filter.hpp"
+#include "data_crunching/internal/hash.hpp"
+
+using namespace dacr;
+using namespace dacr::internal;
+
+TEST(BloomFilter, NumBlocks) {
+    EXPECT_EQ(BlockedBloomFilter{0}.getNumBlocks(), 1);
+    EXPECT_EQ(BlockedBloomFilter{32}.getNumBlocks(), 1);
+    EXPECT_EQ(BlockedBloomFilter{33}.getNumBlocks(), 2);
+    EXPECT_EQ(BlockedBloomFilter{1000}.getNumBlocks(), 32);
+}
+
+TEST(BloomFilter, NoFalseNegatives) {
+    BlockedBloomFilter bloom_filter{10'000};
+    for (std::uint64_t key = 0; key < 10'000; ++key) {
+        bloom_filter.insert(mixHash(key));
+    }
+    for (std::uint64_t key = 0; key < 10'000; ++key) {
+        EXPECT_TRUE(bloom_filter.mayContain(mixHash(key)));
+    }
+}
+
+TEST(BloomFilter, FalsePositiveRate) {
+    BlockedBloomFilter bloom_filter{10'000};
+    for (std::uint64_t key = 0; key < 10'000; ++key) {
+        bloom_filter.insert(mixHash(key));
+    }
+    std::size_t num_false_positives {0};
+    for (std::uint64_t key = 10'000; key < 110'000; ++key) {
+        num_false_positives += bloom_filter.mayContain(mixHash(key));
+    }
+    EXPECT_LT(num_false_positives, 1'000);
+}
@@ -0,0 +1,74 @@
+// Copyright 2022 Andi Hellmund
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include "data_crunching/internal/column_kernels.hpp"
+
+using namespace dacr;
+using namespace dacr::internal;
+
+TEST(ColumnKernels, ReduceSum) {
+    // sizes below, equal to and above the number of lanes
+    for (std::size_t size : {0, 1, 15, 16, 17, 1000}) {
+        std::vector<long> values(size);
+        std::iota(values.begin(), values.end(), -5);
+        EXPECT_EQ(reduceSum<long>(values.data(), size), std::accumulate(values.begin(), values.end(), 0L));
+    }
+
+    std::vector<int> values{std::numeric_limits<int>::max(), std::numeric_limits<int>::max()};
+    EXPECT_DOUBLE_EQ(reduceSum<double>(values.data(), values.size()), 2.0 * std::numeric_limits<int>::max());
+}
+
+TEST(ColumnKernels, ReduceMinMax) {
+    std::vector<double> values{};
+    for (auto i = 0; i < 100; ++i) {
+        values.push_back((i * 37) % 101 - 50.5);
+    }
+    EXPECT_DOUBLE_EQ(reduceMin(values.data(), values.size(), std::numeric_limits<double>::max()), -50.5);
+    EXPECT_DOUBLE_EQ(reduceMax(values.data(), values.size(), std::numeric_limits<double>::lowest()), 49.5);
+
+    // the initial value takes part in the reduction
+    EXPECT_DOUBLE_EQ(reduceMin(values.data(), values.size(), -100.0), -100.0);
+    EXPECT_EQ(reduceMax<int>(nullptr, 0, 7), 7);
+
+    std::vector<float> with_nan{3.0f, std::numeric_limits<float>::quiet_NaN(), -1.0f};
+    EXPECT_FLOAT_EQ(reduceMin(with_nan.data(), with_nan.size(), std::numeric_limits<float>::max()), -1.0f);
+    EXPECT_FLOAT_EQ(reduceMax(with_nan.data(), with_nan.size(), std::numeric_limits<float>::lowest()), 3.0f);
+}
+
+TEST(ColumnKernels, SelectRanks) {
+    std::vector<int> values{};
+    for (auto i = 0; i < 1000; ++i) {
+        values.push_back((i * 7919) % 1000);
+    }
+    auto sorted_values = values;
+    std::sort(sorted_values.begin(), sorted_values.end());
+
+    std::vector<std::size_t> ranks{0, 17, 499, 500, 998, 999};
+    selectRanks(values.begin(), values.end(), ranks);
+    for (auto rank : ranks) {
+        EXPECT_EQ(values[rank], sorted_values[rank]);
+    }
+
+    selectRanks(values.begin(), values.end(), {});
+    std::vector<int> empty{};
+    selectRanks(empty.begin(), empty.end(), {});
+}
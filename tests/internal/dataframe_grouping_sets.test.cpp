@@ -0,0 +1,75 @@
+// Copyright 2022 Andi Hellmund
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "data_crunching/dataframe.hpp"
+#include "data_crunching/internal/dataframe_grouping_sets.hpp"
+
+using namespace dacr;
+using namespace dacr::internal;
+
+TEST(DataFrameGroupingSets, IsGroupingSetsSpec) {
+    EXPECT_TRUE((IsGroupingSetsSpec<Rollup<"a", "b">>));
+    EXPECT_TRUE((IsGroupingSetsSpec<GroupingSets<GroupBy<"a">, GroupBy<>>>));
+    EXPECT_FALSE((IsGroupingSetsSpec<GroupBy<"a", "b">>));
+}
+
+TEST(DataFrameGroupingSets, RollupSets) {
+    EXPECT_TRUE((std::is_same_v<Rollup<"a", "b", "c">::Sets, TypeList<GroupBy<"a", "b", "c">, GroupBy<"a", "b">, GroupBy<"a">, GroupBy<>>>));
+    EXPECT_TRUE((std::is_same_v<Rollup<>::Sets, TypeList<GroupBy<>>>));
+}
+
+TEST(DataFrameGroupingSets, GetGroupingSetsNames) {
+    EXPECT_TRUE((std::is_same_v<GetGroupingSetsNames<Rollup<"a", "b">>, NameList<"a", "b">>));
+    EXPECT_TRUE((std::is_same_v<
+        GetGroupingSetsNames<GroupingSets<GroupBy<"b">, GroupBy<"a", "c">, GroupBy<"c", "b">>>,
+        NameList<"b", "a", "c">
+    >));
+}
+
+TEST(DataFrameGroupingSets, GetGroupingSetKeyIndices) {
+    EXPECT_TRUE((std::is_same_v<
+        GetGroupingSetKeyIndices<GroupingSets<GroupBy<"b">, GroupBy<"a", "c">, GroupBy<"c", "b">, GroupBy<>>>,
+        TypeList<
+            std::integer_sequence<std::size_t, 0>,
+            std::integer_sequence<std::size_t, 1, 2>,
+            std::integer_sequence<std::size_t, 2, 0>,
+            std::integer_sequence<std::size_t>
+        >
+    >));
+}
+
+TEST(DataFrameGroupingSets, GroupingSetsExecuter) {
+    auto data = std::make_tuple(std::vector<std::string>{"a", "b", "a", "c"}, std::vector<std::string>{"x", "x", "y", "x"}, std::vector<double>{1.0, 2.0, 3.0, 4.0});
+    using CompoundSummarizer = GetCompoundSummarizer<TypeList<Sum<"v", "v_sum">>, Column<"k", std::string>, Column<"l", std::string>, Column<"v", double>>;
+    using NewDataFrame = DataFrame<Column<"k", std::string>, Column<"l", std::string>, Column<"grouping_set", std::size_t>, Column<"v_sum", double>>;
+    using SetKeyIndices = GetGroupingSetKeyIndices<GroupingSets<GroupBy<"k", "l">, GroupBy<"k">, GroupBy<"k", "l">, GroupBy<>>>;
+    using Executer = GroupingSetsExecuter<NewDataFrame, std::integer_sequence<std::size_t, 0, 1>, std::tuple<std::string, std::string>, SetKeyIndices, CompoundSummarizer>;
+
+    // the keys of the finest groups are copied for all but the last set of all key columns
+    auto result = Executer::execute(data, 4, SummarizeOptions{});
+    ASSERT_EQ(result.getSize(), 4 + 3 + 4 + 1);
+    EXPECT_THAT(result.getColumn<"k">(), ::testing::ElementsAre("a", "b", "a", "c", "a", "b", "c", "a", "b", "a", "c", ""));
+    EXPECT_THAT(result.getColumn<"l">(), ::testing::ElementsAre("x", "x", "y", "x", "", "", "", "x", "x", "y", "x", ""));
+    EXPECT_THAT(result.getColumn<"grouping_set">(), ::testing::ElementsAre(0, 0, 0, 0, 1, 1, 1, 2, 2, 2, 2, 3));
+    EXPECT_THAT(result.getColumn<"v_sum">(), ::testing::ElementsAre(1.0, 2.0, 3.0, 4.0, 4.0, 2.0, 4.0, 1.0, 2.0, 3.0, 4.0, 10.0));
+}
@@ -0,0 +1,298 @@
+// Copyright 2022 Andi Hellmund
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <span>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "data_crunching/internal/dataframe_join.hpp"
+
+using namespace dacr;
+using namespace dacr::internal;
+
+template <typename HashTable, typename ProbeData, typename ProbeIndices>
+std::vector<std::size_t> getMatches (const HashTable& hash_table, const ProbeData& probe_data, std::size_t probe_row_index, ProbeIndices probe_indices) {
+    std::vector<std::size_t> matches;
+    const auto hash = hashColumnStoreRow(probe_data, probe_row_index, probe_indices);
+    hash_table.forEachMatch(probe_data, probe_row_index, hash, probe_indices, [&matches](std::size_t row_index) {
+        matches.push_back(row_index);
+    });
+    return matches;
+}
+
+TEST(DataFrameJoin, JoinHashTableSingleKey) {
+    auto build_data = std::make_tuple(
+        std::vector<int>{10, 20, 10, 30, 10}
+    );
+    auto probe_data = std::make_tuple(
+        std::vector<double>{1.0, 2.0, 3.0},
+        std::vector<int>{10, 40, 30}
+    );
+
+    auto hash_table = buildJoinHashTable<std::integer_sequence<std::size_t, 0>>(build_data, 5);
+    EXPECT_EQ(hash_table.getSize(), 5);
+
+    using ProbeIndices = std::integer_sequence<std::size_t, 1>;
+    EXPECT_THAT(getMatches(hash_table, probe_data, 0, ProbeIndices{}), ::testing::ElementsAre(0, 2, 4));
+    EXPECT_THAT(getMatches(hash_table, probe_data, 1, ProbeIndices{}), ::testing::ElementsAre());
+    EXPECT_THAT(getMatches(hash_table, probe_data, 2, ProbeIndices{}), ::testing::ElementsAre(3));
+}
+
+TEST(DataFrameJoin, JoinHashTableMultipleKeys) {
+    auto build_data = std::make_tuple(
+        std::vector<std::string>{"a", "a", "b"},
+        std::vector<char>{'X', 'Y', 'X'}
+    );
+    auto probe_data = std::make_tuple(
+        std::vector<char>{'X', 'Y', 'Z'},
+        std::vector<std::string>{"a", "a", "b"}
+    );
+
+    auto hash_table = buildJoinHashTable<std::integer_sequence<std::size_t, 0, 1>>(build_data, 3);
+
+    using ProbeIndices = std::integer_sequence<std::size_t, 1, 0>;
+    EXPECT_THAT(getMatches(hash_table, probe_data, 0, ProbeIndices{}), ::testing::ElementsAre(0));
+    EXPECT_THAT(getMatches(hash_table, probe_data, 1, ProbeIndices{}), ::testing::ElementsAre(1));
+    EXPECT_THAT(getMatches(hash_table, probe_data, 2, ProbeIndices{}), ::testing::ElementsAre());
+}
+
+TEST(DataFrameJoin, JoinHashTableGrowsOnInsert) {
+    std::vector<int> values(1000);
+    for (auto i = 0LU; i < values.size(); ++i) {
+        values[i] = i % 10;
+    }
+    auto build_data = std::make_tuple(values);
+
+    JoinHashTable<decltype(build_data), std::integer_sequence<std::size_t, 0>> hash_table{build_data, 0};
+    for (auto i = 0LU; i < values.size(); ++i) {
+        hash_table.insert(i);
+    }
+    EXPECT_EQ(hash_table.getSize(), 1000);
+
+    auto matches = getMatches(hash_table, build_data, 3, std::integer_sequence<std::size_t, 0>{});
+    ASSERT_EQ(matches.size(), 100);
+    EXPECT_TRUE(std::is_sorted(matches.begin(), matches.end()));
+    EXPECT_TRUE(std::ranges::all_of(matches, [](std::size_t row_index) { return row_index % 10 == 3; }));
+}
+
+TEST(DataFrameJoin, TieColumns) {
+    auto column_store_data = std::make_tuple(
+        std::vector<int>{10},
+        std::vector<double>{1.0},
+        std::vector<char>{'A'}
+    );
+    auto tied_columns = tieColumns(column_store_data, std::integer_sequence<std::size_t, 2, 0>{});
+    EXPECT_TRUE((std::is_same_v<
+        decltype(tied_columns),
+        std::tuple<const std::vector<char>&, const std::vector<int>&>
+    >));
+    EXPECT_EQ(&std::get<0>(tied_columns), &std::get<2>(column_store_data));
+}
+
+std::vector<std::pair<std::size_t, std::size_t>> getMergeJoinMatches (const auto& keys_lhs, const auto& keys_rhs) {
+    std::vector<std::pair<std::size_t, std::size_t>> matches;
+    mergeJoin(keys_lhs, std::get<0>(keys_lhs).size(), keys_rhs, std::get<0>(keys_rhs).size(), [&matches](std::size_t lhs, std::size_t rhs) {
+        matches.emplace_back(lhs, rhs);
+    });
+    return matches;
+}
+
+TEST(DataFrameJoin, MergeJoin) {
+    auto keys_lhs = std::make_tuple(
+        std::vector<int>{1, 1, 2, 2, 4, 5},
+        std::vector<char>{'A', 'B', 'A', 'A', 'A', 'A'}
+    );
+    auto keys_rhs = std::make_tuple(
+        std::vector<int>{1, 2, 2, 3, 5},
+        std::vector<char>{'B', 'A', 'A', 'A', 'B'}
+    );
+
+    using Match = std::pair<std::size_t, std::size_t>;
+    EXPECT_THAT(getMergeJoinMatches(keys_lhs, keys_rhs), ::testing::ElementsAre(
+        Match{1, 0}, Match{2, 1}, Match{2, 2}, Match{3, 1}, Match{3, 2}
+    ));
+}
+
+TEST(DataFrameJoin, MergeJoinUnsortedInput) {
+    auto keys_sorted = std::make_tuple(std::vector<int>{1, 2, 3});
+    auto keys_unsorted = std::make_tuple(std::vector<int>{1, 3, 2});
+    EXPECT_THROW(getMergeJoinMatches(keys_sorted, keys_unsorted), JoinException);
+    EXPECT_THROW(getMergeJoinMatches(keys_unsorted, keys_sorted), JoinException);
+}
+
+TEST(DataFrameJoin, RadixPartition) {
+    std::vector<int> values(1000);
+    for (auto i = 0LU; i < values.size(); ++i) {
+        values[i] = i % 50;
+    }
+    auto column_store_data = std::make_tuple(values);
+    using KeyIndices = std::integer_sequence<std::size_t, 0>;
+
+    auto partitions = radixPartition<KeyIndices>(column_store_data, values.size(), 3, 4);
+    ASSERT_EQ(partitions.offsets.size(), 9);
+    EXPECT_EQ(partitions.offsets.front(), 0);
+    EXPECT_EQ(partitions.offsets.back(), 1000);
+    for (auto partition = 0LU; partition < 8; ++partition) {
+        for (auto index = partitions.offsets[partition]; index < partitions.offsets[partition + 1]; ++index) {
+            const auto row_index = partitions.row_indices[index];
+            EXPECT_EQ(partitions.hashes[index], hashColumnStoreRow(column_store_data, row_index, KeyIndices{}));
+            EXPECT_EQ(getRadixPartition(partitions.hashes[index], 3), partition);
+            if (index > partitions.offsets[partition]) {
+                EXPECT_LT(partitions.row_indices[index - 1], row_index);
+            }
+        }
+    }
+}
+
+TEST(DataFrameJoin, PartitionedHashJoin) {
+    std::vector<int> values_lhs(3000);
+    for (auto i = 0LU; i < values_lhs.size(); ++i) {
+        values_lhs[i] = i % 1000;
+    }
+    std::vector<int> values_rhs(500);
+    for (auto i = 0LU; i < values_rhs.size(); ++i) {
+        values_rhs[i] = 2 * i;
+    }
+    auto data_lhs = std::make_tuple(values_lhs);
+    auto data_rhs = std::make_tuple(std::vector<double>(values_rhs.size(), 0.0), values_rhs);
+
+    auto matches = partitionedHashJoin<std::integer_sequence<std::size_t, 0>, std::integer_sequence<std::size_t, 1>>(
+        data_lhs, values_lhs.size(), data_rhs, values_rhs.size(), 4
+    );
+
+    std::vector<std::pair<std::size_t, std::size_t>> all_matches;
+    for (const auto& partition_matches : matches) {
+        for (auto index = 0LU; index < partition_matches.getSize(); ++index) {
+            all_matches.emplace_back(partition_matches.row_indices_lhs[index], partition_matches.row_indices_rhs[index]);
+        }
+    }
+    EXPECT_EQ(all_matches.size(), 1500);
+    EXPECT_TRUE(std::ranges::all_of(all_matches, [&](const auto& match) {
+        return values_lhs[match.first] == values_rhs[match.second];
+    }));
+    std::ranges::sort(all_matches);
+    EXPECT_EQ(std::ranges::adjacent_find(all_matches), all_matches.end());
+}
+
+TEST(DataFrameJoin, FlattenJoinMatches) {
+    std::vector<JoinMatches> partition_matches(3);
+    partition_matches[0].add(1, 2);
+    partition_matches[2].add(3, 4);
+    partition_matches[2].add(5, 6);
+
+    auto matches = flattenJoinMatches(partition_matches, 2);
+    EXPECT_THAT(matches.row_indices_lhs, ::testing::ElementsAre(1, 3, 5));
+    EXPECT_THAT(matches.row_indices_rhs, ::testing::ElementsAre(2, 4, 6));
+}
+
+TEST(DataFrameJoin, GatherColumn) {
+    std::vector<std::string> column_in{"a", "b", "c"};
+    std::vector<std::size_t> row_indices{2, 0, 2};
+
+    std::vector<std::string> column_out(4);
+    gatherColumn<false>(column_out, column_in, std::span{row_indices}, 1);
+    EXPECT_THAT(column_out, ::testing::ElementsAre("", "c", "a", "c"));
+
+    std::vector<bool> bool_column_in{true, false, false};
+    std::vector<bool> bool_column_out(3);
+    gatherColumn<false>(bool_column_out, bool_column_in, std::span{row_indices}, 0);
+    EXPECT_THAT(bool_column_out, ::testing::ElementsAre(false, false, false));
+    gatherColumn<true>(bool_column_out, bool_column_in, std::span{row_indices}, 0);
+    EXPECT_THAT(bool_column_out, ::testing::ElementsAre(false, true, false));
+}
+
+TEST(DataFrameJoin, HashJoinAndNestedLoopJoin) {
+    auto data_lhs = std::make_tuple(std::vector<int>{1, 2, 1, 3});
+    auto data_rhs = std::make_tuple(std::vector<char>{'x', 'y', 'z'}, std::vector<int>{1, 3, 1});
+    using KeyIndicesLhs = std::integer_sequence<std::size_t, 0>;
+    using KeyIndicesRhs = std::integer_sequence<std::size_t, 1>;
+
+    auto hash_matches = hashJoin<KeyIndicesLhs, KeyIndicesRhs>(data_lhs, 4, data_rhs, 3);
+    EXPECT_THAT(hash_matches.row_indices_lhs, ::testing::ElementsAre(0, 0, 2, 2, 3));
+    EXPECT_THAT(hash_matches.row_indices_rhs, ::testing::ElementsAre(0, 2, 0, 2, 1));
+
+    auto nested_loop_matches = nestedLoopJoin(data_lhs, 4, KeyIndicesLhs{}, data_rhs, 3, KeyIndicesRhs{});
+    EXPECT_EQ(nested_loop_matches.row_indices_lhs, hash_matches.row_indices_lhs);
+    EXPECT_EQ(nested_loop_matches.row_indices_rhs, hash_matches.row_indices_rhs);
+
+    // the hash table is built on the smaller left side, the matches are still ordered by the left rows
+    auto hash_matches_lhs_build = hashJoin<KeyIndicesRhs, KeyIndicesLhs>(data_rhs, 3, data_lhs, 4);
+    EXPECT_THAT(hash_matches_lhs_build.row_indices_lhs, ::testing::ElementsAre(0, 0, 1, 2, 2));
+    EXPECT_THAT(hash_matches_lhs_build.row_indices_rhs, ::testing::ElementsAre(0, 2, 3, 0, 2));
+}
+
+TEST(DataFrameJoin, SemiJoin) {
+    auto data_lhs = std::make_tuple(std::vector<int>{1, 2, 1, 3});
+    auto data_rhs = std::make_tuple(std::vector<int>{1, 3, 1});
+    using KeyIndices = std::integer_sequence<std::size_t, 0>;
+
+    EXPECT_THAT((hashSemiJoin<KeyIndices, KeyIndices>(data_lhs, 4, data_rhs, 3)), ::testing::ElementsAre(1, 0, 1, 1));
+    EXPECT_THAT((hashSemiJoin<KeyIndices, KeyIndices>(data_rhs, 3, data_lhs, 4)), ::testing::ElementsAre(1, 1, 1));
+    EXPECT_THAT(nestedLoopSemiJoin(data_lhs, 4, KeyIndices{}, data_rhs, 3, KeyIndices{}), ::testing::ElementsAre(1, 0, 1, 1));
+}
+
+TEST(DataFrameJoin, CreateJoinBloomFilter) {
+    EXPECT_TRUE(createJoinBloomFilter(JoinBloomFilter::Auto, 100, 800).has_value());
+    EXPECT_FALSE(createJoinBloomFilter(JoinBloomFilter::Auto, 100, 799).has_value());
+    EXPECT_FALSE(createJoinBloomFilter(JoinBloomFilter::Auto, 0, 0).has_value());
+    EXPECT_TRUE(createJoinBloomFilter(JoinBloomFilter::Enabled, 100, 100).has_value());
+    EXPECT_FALSE(createJoinBloomFilter(JoinBloomFilter::Disabled, 100, 10'000).has_value());
+}
+
+TEST(DataFrameJoin, HashJoinWithBloomFilter) {
+    std::vector<int> values_lhs(1000);
+    for (auto i = 0LU; i < values_lhs.size(); ++i) {
+        values_lhs[i] = i;
+    }
+    auto data_lhs = std::make_tuple(values_lhs);
+    auto data_rhs = std::make_tuple(std::vector<int>{5, 500, 5000});
+    using KeyIndices = std::integer_sequence<std::size_t, 0>;
+
+    for (auto mode : {JoinBloomFilter::Auto, JoinBloomFilter::Enabled, JoinBloomFilter::Disabled}) {
+        auto matches = hashJoin<KeyIndices, KeyIndices>(data_lhs, 1000, data_rhs, 3, mode);
+        EXPECT_THAT(matches.row_indices_lhs, ::testing::ElementsAre(5, 500));
+        EXPECT_THAT(matches.row_indices_rhs, ::testing::ElementsAre(0, 1));
+        EXPECT_THAT((hashSemiJoin<KeyIndices, KeyIndices>(data_rhs, 3, data_lhs, 1000, mode)), ::testing::ElementsAre(1, 1, 0));
+    }
+}
+
+TEST(DataFrameJoin, AsOfJoin) {
+    auto keys_lhs = std::make_tuple(
+        std::vector<char>{'A', 'A', 'A', 'B'},
+        std::vector<int>{1, 5, 7, 2}
+    );
+    auto keys_rhs = std::make_tuple(
+        std::vector<char>{'A', 'A', 'A', 'B'},
+        std::vector<int>{2, 5, 5, 3}
+    );
+    auto matches = asOfJoin(keys_lhs, 4, keys_rhs, 4);
+    EXPECT_THAT(matches.row_indices_lhs, ::testing::ElementsAre(1, 2));
+    EXPECT_THAT(matches.row_indices_rhs, ::testing::ElementsAre(2, 2));
+
+    auto time_lhs = std::make_tuple(std::vector<int>{0, 3, 9});
+    auto time_rhs = std::make_tuple(std::vector<int>{1, 3, 4});
+    auto time_matches = asOfJoin(time_lhs, 3, time_rhs, 3);
+    EXPECT_THAT(time_matches.row_indices_lhs, ::testing::ElementsAre(1, 2));
+    EXPECT_THAT(time_matches.row_indices_rhs, ::testing::ElementsAre(1, 2));
+
+    auto unsorted = std::make_tuple(std::vector<int>{3, 1});
+    EXPECT_THROW(asOfJoin(unsorted, 2, time_rhs, 3), JoinException);
+}
@@ -0,0 +1,116 @@
+// Copyright 2022 Andi Hellmund
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <ranges>
+#include <tuple>
+#include <vector>
+
+#include "data_crunching/internal/dataframe_rolling.hpp"
+
+using namespace dacr;
+using namespace dacr::internal;
+
+TEST(DataFrameRolling, AreRollingOps) {
+    EXPECT_TRUE((are_rolling_ops<TypeList<Sum<"a", "b">, Avg<"a", "c">, Min<"a", "d">, Max<"a", "e">, CountIf<"f", "g">>>));
+    EXPECT_FALSE((are_rolling_ops<TypeList<Sum<"a", "b">, StdDev<"a", "c">>>));
+    EXPECT_FALSE((are_rolling_ops<TypeList<Median<"a", "b">>>));
+}
+
+TEST(DataFrameRolling, GetRollingAggregatorForOp) {
+    EXPECT_TRUE((std::is_same_v<GetRollingAggregatorForOp<Sum<"b", "s">, Column<"a", bool>, Column<"b", double>>, RollingSum<1, double>>));
+    EXPECT_TRUE((std::is_same_v<GetRollingAggregatorForOp<Max<"b", "m">, Column<"a", bool>, Column<"b", double>>, RollingMax<1, double>>));
+    EXPECT_TRUE((std::is_same_v<GetRollingAggregatorForOp<CountIfNot<"a", "c">, Column<"a", bool>, Column<"b", double>>, RollingCount<0, false>>));
+}
+
+TEST(DataFrameRolling, RollingExecuterMatchesRecomputation) {
+    std::vector<int> values(1'000);
+    for (auto i = 0LU; i < values.size(); ++i) {
+        values[i] = static_cast<int>((i * 7919) % 201) - 100;
+    }
+    auto data = std::make_tuple(values);
+
+    constexpr std::size_t WINDOW_SIZE = 37;
+    RollingExecuter<WINDOW_SIZE, RollingSum<0, int>, RollingAvg<0, int>, RollingMin<0, int>, RollingMax<0, int>> executer{values.size()};
+    executer.rollPartition(data, std::views::iota(0LU, values.size()));
+    const auto& [sums, avgs, mins, maxs] = executer.getResults();
+
+    for (auto i = 0LU; i < values.size(); ++i) {
+        const auto begin = values.begin() + (i + 1 >= WINDOW_SIZE ? i + 1 - WINDOW_SIZE : 0);
+        const auto end = values.begin() + i + 1;
+        int sum {0};
+        std::for_each(begin, end, [&](int value) { sum += value; });
+        EXPECT_EQ(sums[i], sum);
+        EXPECT_NEAR(avgs[i], static_cast<double>(sum) / (end - begin), 1e-9);
+        EXPECT_EQ(mins[i], *std::min_element(begin, end));
+        EXPECT_EQ(maxs[i], *std::max_element(begin, end));
+    }
+}
+
+TEST(DataFrameRolling, RollingExtremumIgnoresNaN) {
+    constexpr double NaN = std::numeric_limits<double>::quiet_NaN();
+    auto data = std::make_tuple(std::vector<double>{NaN, 3.0, NaN, 1.0, 2.0});
+    RollingExecuter<2, RollingMin<0, double>, RollingMax<0, double>> executer{5};
+    executer.rollPartition(data, std::views::iota(0LU, 5LU));
+    const auto& [mins, maxs] = executer.getResults();
+    EXPECT_EQ(mins[0], std::numeric_limits<double>::max());
+    EXPECT_THAT(std::vector<double>(mins.begin() + 1, mins.end()), ::testing::ElementsAre(3.0, 3.0, 1.0, 1.0));
+    EXPECT_THAT(std::vector<double>(maxs.begin() + 1, maxs.end()), ::testing::ElementsAre(3.0, 3.0, 1.0, 2.0));
+}
+
+TEST(DataFrameRolling, RollingSumIgnoresNaN) {
+    constexpr double NaN = std::numeric_limits<double>::quiet_NaN();
+    auto data = std::make_tuple(std::vector<double>{1.0, NaN, 2.0, 3.0, 4.0, 5.0});
+    RollingExecuter<2, RollingSum<0, double>, RollingAvg<0, double>> executer{6};
+    executer.rollPartition(data, std::views::iota(0LU, 6LU));
+    const auto& [sums, avgs] = executer.getResults();
+    EXPECT_THAT(sums, ::testing::ElementsAre(1.0, 1.0, 2.0, 5.0, 7.0, 9.0));
+    EXPECT_THAT(avgs, ::testing::ElementsAre(1.0, 1.0, 2.0, 2.5, 3.5, 4.5));
+}
+
+TEST(DataFrameRolling, RollingSumOfInfinity) {
+    constexpr double Inf = std::numeric_limits<double>::infinity();
+    auto data = std::make_tuple(std::vector<double>{1.0, Inf, 2.0, -Inf, 3.0, 4.0});
+    RollingExecuter<2, RollingSum<0, double>> executer{6};
+    executer.rollPartition(data, std::views::iota(0LU, 6LU));
+    const auto& [sums] = executer.getResults();
+    EXPECT_EQ(sums[0], 1.0);
+    EXPECT_EQ(sums[1], Inf);
+    EXPECT_EQ(sums[2], Inf);
+    EXPECT_EQ(sums[3], -Inf);
+    EXPECT_EQ(sums[4], -Inf);
+    EXPECT_EQ(sums[5], 7.0);
+}
+
+TEST(DataFrameRolling, CompensatedSum) {
+    CompensatedSum<double> sum{};
+    sum.add(1e16);
+    for (auto i = 0; i < 1'000; ++i) {
+        sum.add(1.0);
+    }
+    sum.add(-1e16);
+    EXPECT_EQ(sum.getSum(), 1'000.0);
+}
+
+TEST(DataFrameRolling, PartitionRows) {
+    auto data = std::make_tuple(std::vector<int>{5, 7, 5, 9, 7, 5});
+    const auto [row_indices, offsets] = partitionRows<GroupBy<"key">, std::integer_sequence<std::size_t, 0>, std::tuple<int>>(data, 6);
+    EXPECT_THAT(row_indices, ::testing::ElementsAre(0, 2, 5, 1, 4, 3));
+    EXPECT_THAT(offsets, ::testing::ElementsAre(0, 3, 5, 6));
+}
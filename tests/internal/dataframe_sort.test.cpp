@@ -53,6 +53,24 @@ TEST(DataFrameSort, CompareElementsForSort) {
     EXPECT_FALSE(ComparisonTwoColumnsDesc::compare(column_store_data, 1, 2));
 }
 
+TEST(DataFrameSort, CompareElementsForSortAcrossColumnStores) {
+    auto column_store_data_lhs = std::make_tuple(
+        std::vector<int>{10, 5},
+        std::vector<char>{'Z', 'B'}
+    );
+    auto column_store_data_rhs = std::make_tuple(
+        std::vector<int>{5, 10},
+        std::vector<char>{'E', 'A'}
+    );
+
+    using ComparisonTwoColumnsAsc = CompareElementsForSort<SortOrder::Ascending, 0, 
+        CompareElementsForSort<SortOrder::Ascending, 1, void>>;
+    EXPECT_FALSE(ComparisonTwoColumnsAsc::compare(column_store_data_lhs, 0, column_store_data_rhs, 0));
+    EXPECT_FALSE(ComparisonTwoColumnsAsc::compare(column_store_data_lhs, 0, column_store_data_rhs, 1));
+    EXPECT_TRUE(ComparisonTwoColumnsAsc::compare(column_store_data_lhs, 1, column_store_data_rhs, 0));
+    EXPECT_TRUE(ComparisonTwoColumnsAsc::compare(column_store_data_rhs, 1, column_store_data_lhs, 0));
+}
+
 TEST(DataFramePrint, ConstructElementComparison) {
     EXPECT_TRUE((std::is_same_v<
         ConstructElementComparison<SortOrder::Ascending, std::integer_sequence<std::size_t, 0>>,
@@ -15,7 +15,12 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include <cmath>
+#include <limits>
+#include <map>
+#include <string>
 #include <type_traits>
+#include <utility>
 #include <vector>
 #include <tuple>
 
@@ -66,6 +71,222 @@ TEST(DataFrameSummarize, SummarizerStdDev) {
     EXPECT_FLOAT_EQ(summarizer.getState(), 2.1602468994693f);
 }
 
+template <typename Summarizer, typename ColumnStoreData>
+void expectSummarizeRangeEqualsRowWise (const ColumnStoreData& data) {
+    Summarizer row_wise{};
+    applyToSummarizer(row_wise, data);
+    Summarizer range{};
+    range.summarizeRange(data, 0, 10);
+    range.summarizeRange(data, 10, std::get<0>(data).size());
+    EXPECT_DOUBLE_EQ(range.getState(), row_wise.getState());
+}
+
+TEST(DataFrameSummarize, SummarizeRange) {
+    std::vector<int> values{};
+    for (auto i = 0; i < 1000; ++i) {
+        values.push_back((i * 7919) % 1009 - 500);
+    }
+    auto data = std::make_tuple(values);
+    expectSummarizeRangeEqualsRowWise<SummarizerSum<0, int>>(data);
+    expectSummarizeRangeEqualsRowWise<SummarizerMin<0, int>>(data);
+    expectSummarizeRangeEqualsRowWise<SummarizerMax<0, int>>(data);
+    expectSummarizeRangeEqualsRowWise<SummarizerAvg<0, int>>(data);
+
+    EXPECT_TRUE((HasSummarizeRange<SummarizerSum<0, int>, decltype(data)>));
+    EXPECT_FALSE((HasSummarizeRange<SummarizerStdDev<0, int>, decltype(data)>));
+}
+
+TEST(DataFrameSummarize, SummarizerCountDistinctApprox) {
+    std::vector<std::string> values{};
+    for (auto i = 0; i < 3000; ++i) {
+        values.push_back("user" + std::to_string(i % 1000));
+    }
+    auto data = std::make_tuple(values);
+    SummarizerCountDistinctApprox<0, std::string, 12> summarizer;
+    applyToSummarizer(summarizer, data);
+    EXPECT_NEAR(summarizer.getState(), 1000, 30);
+
+    EXPECT_TRUE((std::is_same_v<
+        GetColumnForOp<CountDistinctApprox<"a", "a_uniq">, Column<"a", int>>,
+        Column<"a_uniq", std::size_t>
+    >));
+    EXPECT_TRUE((std::is_same_v<
+        GetSummarizerForOp<CountDistinctApprox<"a", "a_uniq", 8>, Column<"b", int>, Column<"a", std::string>>,
+        SummarizerCountDistinctApprox<1, std::string, 8>
+    >));
+    EXPECT_TRUE((are_valid_summarize_ops<TypeList<CountDistinctApprox<"a", "a_uniq">, Sum<"b", "b_sum">>, Column<"a", int>, Column<"b", int>>));
+    EXPECT_FALSE((are_valid_summarize_ops<TypeList<CountDistinctApprox<"c", "c_uniq">>, Column<"a", int>, Column<"b", int>>));
+}
+
+TEST(DataFrameSummarize, SummarizerQuantile) {
+    std::vector<int> values{};
+    for (auto i = 1; i <= 10'000; ++i) {
+        values.push_back((i * 7919) % 10'007);
+    }
+    auto data = std::make_tuple(values);
+    SummarizerQuantile<0, int, 50> median;
+    applyToSummarizer(median, data);
+    EXPECT_NEAR(median.getState(), 5'000, 100);
+    SummarizerQuantile<0, int, 99> p99;
+    applyToSummarizer(p99, data);
+    EXPECT_NEAR(p99.getState(), 9'906, 20);
+
+    EXPECT_TRUE((std::is_same_v<
+        GetColumnForOp<Quantile<"a", "a_p95", 95>, Column<"a", int>>,
+        Column<"a_p95", double>
+    >));
+    EXPECT_TRUE((std::is_same_v<
+        GetSummarizerForOp<Median<"a", "a_median">, Column<"b", int>, Column<"a", float>>,
+        SummarizerQuantile<1, float, 50>
+    >));
+    EXPECT_TRUE((are_valid_summarize_ops<TypeList<Quantile<"a", "a_p95", 95>, Median<"b", "b_median">>, Column<"a", int>, Column<"b", int>>));
+}
+
+TEST(DataFrameSummarize, SummarizerExactQuantile) {
+    ValueArena<int> arena{};
+    auto data = std::make_tuple(std::vector<int>{7, 1, 3, 10, 5});
+
+    SummarizerExactQuantile<0, int, 50> median{arena};
+    applyToSummarizer(median, data);
+    EXPECT_DOUBLE_EQ(median.getState(), 5.0);
+    // the state is not modified by getState
+    EXPECT_DOUBLE_EQ(median.getState(), 5.0);
+
+    // position 0.9 * 4 = 3.6 between 7 and 10
+    SummarizerExactQuantile<0, int, 90> p90{arena};
+    applyToSummarizer(p90, data);
+    EXPECT_DOUBLE_EQ(p90.getState(), 8.8);
+
+    SummarizerExactQuantile<0, int, 100> p100{arena};
+    applyToSummarizer(p100, data);
+    EXPECT_DOUBLE_EQ(p100.getState(), 10.0);
+
+    SummarizerExactQuantile<0, int, 0> p0{arena};
+    applyToSummarizer(p0, data);
+    EXPECT_DOUBLE_EQ(p0.getState(), 1.0);
+
+    SummarizerExactQuantile<0, int, 50> empty{arena};
+    EXPECT_TRUE(std::isnan(empty.getState()));
+
+    // merged states combine the values of both
+    ValueArena<int> other_arena{};
+    SummarizerExactQuantile<0, int, 50> other_median{other_arena};
+    auto other_data = std::make_tuple(std::vector<int>{20, 30, 40, 50});
+    applyToSummarizer(other_median, other_data);
+    median.merge(other_median);
+    EXPECT_DOUBLE_EQ(median.getState(), 10.0);
+
+    EXPECT_TRUE((HasSummarizerArena<SummarizerExactQuantile<0, int, 50>>));
+    EXPECT_FALSE((HasSummarizerArena<SummarizerSum<0, int>>));
+    EXPECT_TRUE((std::is_same_v<
+        GetSummarizerForOp<ExactMedian<"a", "a_median">, Column<"b", int>, Column<"a", float>>,
+        SummarizerExactQuantile<1, float, 50>
+    >));
+    EXPECT_TRUE((std::is_same_v<
+        GetColumnForOp<ExactQuantile<"a", "a_p95", 95>, Column<"a", int>>,
+        Column<"a_p95", double>
+    >));
+}
+
+TEST(DataFrameSummarize, SummarizerExactQuantileShared) {
+    ValueArena<int> arena{};
+    auto data = std::make_tuple(std::vector<int>{7, 1, 3, 10, 5});
+
+    SummarizerExactQuantile<0, int, 90, 0, 50> quantiles{arena};
+    applyToSummarizer(quantiles, data);
+    EXPECT_DOUBLE_EQ((quantiles.getStateOf<SummarizerExactQuantile<0, int, 50>>()), 5.0);
+    EXPECT_DOUBLE_EQ((quantiles.getStateOf<SummarizerExactQuantile<0, int, 90>>()), 8.8);
+    EXPECT_DOUBLE_EQ((quantiles.getStateOf<SummarizerExactQuantile<0, int, 0>>()), 1.0);
+
+    // added values invalidate the selected ranks
+    auto other_data = std::make_tuple(std::vector<int>{20, 30, 40, 50});
+    applyToSummarizer(quantiles, other_data);
+    EXPECT_DOUBLE_EQ((quantiles.getStateOf<SummarizerExactQuantile<0, int, 50>>()), 10.0);
+    EXPECT_DOUBLE_EQ((quantiles.getStateOf<SummarizerExactQuantile<0, int, 0>>()), 1.0);
+
+    // all exact quantiles of a column share one summarizer
+    using Summarizer = GetCompoundSummarizer<
+        TypeList<
+            ExactMedian<"a", "a_median">,
+            ExactQuantile<"b", "b_p90", 90>,
+            ExactQuantile<"a", "a_p99", 99>
+        >,
+        Column<"a", int>,
+        Column<"b", double>
+    >;
+    EXPECT_TRUE((std::is_same_v<
+        Summarizer,
+        FusedCompoundSummarizer<
+            TypeList<
+                SummarizerResult<0, SummarizerExactQuantile<0, int, 50>>,
+                SummarizerResult<1, SummarizerExactQuantile<1, double, 90>>,
+                SummarizerResult<0, SummarizerExactQuantile<0, int, 99>>
+            >,
+            TypeList<SummarizerExactQuantile<0, int, 50, 99>, SummarizerExactQuantile<1, double, 90>>
+        >
+    >));
+}
+
+TEST(DataFrameSummarize, SummarizerMoments) {
+    auto data = std::make_tuple(std::vector<int>{2, 4, 4, 4, 5, 5, 7, 9});
+
+    SummarizerVariance<0, int> variance;
+    applyToSummarizer(variance, data);
+    EXPECT_DOUBLE_EQ(variance.getState(), 4.0);
+
+    SummarizerSampleVariance<0, int> sample_variance;
+    applyToSummarizer(sample_variance, data);
+    EXPECT_DOUBLE_EQ(sample_variance.getState(), 32.0 / 7.0);
+
+    SummarizerStdDev<0, int> stddev;
+    applyToSummarizer(stddev, data);
+    EXPECT_DOUBLE_EQ(stddev.getState(), 2.0);
+
+    SummarizerSampleStdDev<0, int> sample_stddev;
+    applyToSummarizer(sample_stddev, data);
+    EXPECT_DOUBLE_EQ(sample_stddev.getState(), std::sqrt(32.0 / 7.0));
+
+    // m3 = 42 / 8, m2 = 4
+    SummarizerSkewness<0, int> skewness;
+    applyToSummarizer(skewness, data);
+    EXPECT_DOUBLE_EQ(skewness.getState(), 5.25 / 8.0);
+
+    // m4 = 356 / 8, m2 = 4
+    SummarizerKurtosis<0, int> kurtosis;
+    applyToSummarizer(kurtosis, data);
+    EXPECT_NEAR(kurtosis.getState(), 44.5 / 16.0 - 3.0, 1e-12);
+}
+
+TEST(DataFrameSummarize, SummarizerMomentsUndefined) {
+    auto empty = std::make_tuple(std::vector<double>{});
+    SummarizerStdDev<0, double> stddev;
+    applyToSummarizer(stddev, empty);
+    EXPECT_TRUE(std::isnan(stddev.getState()));
+
+    auto single = std::make_tuple(std::vector<double>{3.0});
+    SummarizerVariance<0, double> variance;
+    applyToSummarizer(variance, single);
+    EXPECT_DOUBLE_EQ(variance.getState(), 0.0);
+    SummarizerSampleVariance<0, double> sample_variance;
+    applyToSummarizer(sample_variance, single);
+    EXPECT_TRUE(std::isnan(sample_variance.getState()));
+    SummarizerSkewness<0, double> skewness;
+    applyToSummarizer(skewness, single);
+    EXPECT_TRUE(std::isnan(skewness.getState()));
+}
+
+TEST(DataFrameSummarize, SummarizerMomentsNumericalStability) {
+    // a large offset cancels catastrophically in the sum-of-squares formula
+    std::vector<double> values{};
+    for (auto i = 0; i < 1000; ++i) {
+        values.push_back(1e9 + (i % 2 == 0 ? 1.0 : -1.0));
+    }
+    auto data = std::make_tuple(values);
+    SummarizerVariance<0, double> variance;
+    applyToSummarizer(variance, data);
+    EXPECT_NEAR(variance.getState(), 1.0, 1e-6);
+}
+
 TEST(DataFrameSummarize, SummarizerCountIfCountIfNot) {
     auto data = std::make_tuple(std::vector<bool>{true, false, true});
     SummarizerCountIf<0, bool> summarizer;
@@ -186,6 +407,14 @@ TEST(DataFrameSummarizer, GetSummarizerForOp) {
     >));
     EXPECT_TRUE((std::is_same_v<SummarizerForStdDev::TargetType, double>));
 
+    // Operation: Kurtosis
+    using SummarizerForKurtosis = GetSummarizerForOp<Kurtosis<"a", "a_kurtosis">, Column<"0", double>, Column<"a", float>>;
+    EXPECT_TRUE((std::is_same_v<
+        SummarizerForKurtosis,
+        SummarizerMoments<1, float, MomentStatistic::Kurtosis>
+    >));
+    EXPECT_TRUE((std::is_same_v<SummarizerForKurtosis::TargetType, double>));
+
     // Operation: CountIf
     using SummarizerForCountIf = GetSummarizerForOp<CountIf<"a", "a_cntif">, Column<"a", bool>, Column<"b", float>>;
     EXPECT_TRUE((std::is_same_v<
@@ -221,4 +450,284 @@ TEST(DataFrameSummarize, GetCompoundSummarizer) {
             SummarizerAvg<2, int>
         >
     >));
-}
\ No newline at end of file
+}
+
+TEST(DataFrameSummarize, GetCompoundSummarizerFused) {
+    using Summarizer = GetCompoundSummarizer<
+        TypeList<
+            Sum<"b", "b_sum">,
+            Max<"c", "c_max">,
+            Avg<"b", "b_avg">,
+            StdDev<"b", "b_stddev">,
+            Min<"b", "b_min">
+        >,
+        Column<"a", bool>,
+        Column<"b", double>,
+        Column<"c", int>
+    >;
+    using Fused = SummarizerFused<1, double, FusedFeatures{.sum = true, .min = true, .moment_order = 2}>;
+    EXPECT_TRUE((std::is_same_v<
+        Summarizer,
+        FusedCompoundSummarizer<
+            TypeList<
+                SummarizerResult<0, SummarizerSum<1, double>>,
+                SummarizerResult<1, SummarizerMax<2, int>>,
+                SummarizerResult<0, SummarizerAvg<1, double>>,
+                SummarizerResult<0, SummarizerStdDev<1, double>>,
+                SummarizerResult<0, SummarizerMin<1, double>>
+            >,
+            TypeList<Fused, SummarizerMax<2, int>>
+        >
+    >));
+    EXPECT_EQ(Summarizer::NumSummarizers, 2);
+    EXPECT_EQ(Summarizer::NumResults, 5);
+    EXPECT_LT(sizeof(Fused), sizeof(SummarizerSum<1, double>) + sizeof(SummarizerAvg<1, double>) + sizeof(SummarizerStdDev<1, double>) + sizeof(SummarizerMin<1, double>));
+
+    auto data = std::make_tuple(std::vector<bool>{true, false, true}, std::vector<double>{2.0, 4.0, 9.0}, std::vector<int>{3, 1, 2});
+    NoSummarizerArena arena{};
+    std::tuple<NoSummarizerArena, NoSummarizerArena> arenas{arena, arena};
+    auto summarizer_data = Summarizer::create(arenas);
+    for (auto i = 0LU; i < 3; ++i) {
+        Summarizer::summarize(summarizer_data, data, i);
+    }
+    EXPECT_DOUBLE_EQ(Summarizer::getResult<0>(summarizer_data), 15.0);
+    EXPECT_EQ(Summarizer::getResult<1>(summarizer_data), 3);
+    EXPECT_DOUBLE_EQ(Summarizer::getResult<2>(summarizer_data), 5.0);
+    EXPECT_DOUBLE_EQ(Summarizer::getResult<3>(summarizer_data), std::sqrt(26.0 / 3));
+    EXPECT_DOUBLE_EQ(Summarizer::getResult<4>(summarizer_data), 2.0);
+}
+
+TEST(DataFrameSummarize, SummarizationExecuterGroupByHash) {
+    std::vector<int> keys(10'000);
+    std::vector<char> sub_keys(keys.size());
+    for (auto i = 0LU; i < keys.size(); ++i) {
+        keys[i] = (i * 7919) % 3'000;
+        sub_keys[i] = 'A' + (i / 3'000) % 3;
+    }
+    auto data = std::make_tuple(keys, sub_keys);
+
+    using Executer = SummarizationExecuterGroupBy<void, std::integer_sequence<std::size_t, 0, 1>, std::tuple<int, char>, CompoundSummarizer<>>;
+    Executer executer{};
+    std::vector<std::size_t> group_indices(keys.size());
+    for (auto i = 0LU; i < keys.size(); ++i) {
+        group_indices[i] = executer.getOrCreateGroupIndex(data, i);
+    }
+    EXPECT_EQ(executer.getNumGroups(), 9'000);
+
+    // groups are numbered in the order of their first appearance
+    std::map<std::pair<int, char>, std::size_t> expected_group_indices{};
+    for (auto i = 0LU; i < keys.size(); ++i) {
+        const auto [iter, is_new_group] = expected_group_indices.try_emplace({keys[i], sub_keys[i]}, expected_group_indices.size());
+        EXPECT_EQ(group_indices[i], iter->second);
+    }
+}
+
+struct NonHashableKey {
+    int key;
+    bool operator== (const NonHashableKey&) const = default;
+};
+
+TEST(DataFrameSummarize, SummarizationExecuterGroupByNonHashable) {
+    auto data = std::make_tuple(std::vector<NonHashableKey>{{3}, {1}, {3}, {2}, {1}});
+
+    using Executer = SummarizationExecuterGroupBy<void, std::integer_sequence<std::size_t, 0>, std::tuple<NonHashableKey>, CompoundSummarizer<>>;
+    Executer executer{};
+    std::vector<std::size_t> group_indices{};
+    for (auto i = 0LU; i < 5; ++i) {
+        group_indices.push_back(executer.getOrCreateGroupIndex(data, i));
+    }
+    EXPECT_EQ(executer.getNumGroups(), 3);
+    EXPECT_THAT(group_indices, ::testing::ElementsAre(0, 1, 0, 2, 1));
+}
+
+template <typename Summarizer, typename ColumnStoreData>
+Summarizer summarizeRange (const ColumnStoreData& data, std::size_t begin, std::size_t end) {
+    Summarizer summarizer{};
+    for (auto loop_index = begin; loop_index < end; ++loop_index) {
+        summarizer.summarize(data, loop_index);
+    }
+    return summarizer;
+}
+
+template <typename Summarizer, typename ColumnStoreData>
+std::pair<typename Summarizer::TargetType, typename Summarizer::TargetType> getMergedAndSerialState (const ColumnStoreData& data, std::size_t split) {
+    const auto size = std::get<0>(data).size();
+    auto summarizer = summarizeRange<Summarizer>(data, 0, split);
+    summarizer.merge(summarizeRange<Summarizer>(data, split, size));
+    return {summarizer.getState(), summarizeRange<Summarizer>(data, 0, size).getState()};
+}
+
+TEST(DataFrameSummarize, SummarizerMerge) {
+    auto data = std::make_tuple(std::vector<int>{4, -2, 9, 7, 1}, std::vector<bool>{true, false, false, true, true});
+    for (std::size_t split : {0, 2, 5}) {
+        auto [sum_merged, sum_serial] = getMergedAndSerialState<SummarizerSum<0, int>>(data, split);
+        EXPECT_EQ(sum_merged, sum_serial);
+        auto [min_merged, min_serial] = getMergedAndSerialState<SummarizerMin<0, int>>(data, split);
+        EXPECT_EQ(min_merged, min_serial);
+        auto [max_merged, max_serial] = getMergedAndSerialState<SummarizerMax<0, int>>(data, split);
+        EXPECT_EQ(max_merged, max_serial);
+        auto [avg_merged, avg_serial] = getMergedAndSerialState<SummarizerAvg<0, int>>(data, split);
+        EXPECT_DOUBLE_EQ(avg_merged, avg_serial);
+        auto [stddev_merged, stddev_serial] = getMergedAndSerialState<SummarizerStdDev<0, int>>(data, split);
+        EXPECT_DOUBLE_EQ(stddev_merged, stddev_serial);
+        auto [sample_variance_merged, sample_variance_serial] = getMergedAndSerialState<SummarizerSampleVariance<0, int>>(data, split);
+        EXPECT_DOUBLE_EQ(sample_variance_merged, sample_variance_serial);
+        auto [skewness_merged, skewness_serial] = getMergedAndSerialState<SummarizerSkewness<0, int>>(data, split);
+        EXPECT_NEAR(skewness_merged, skewness_serial, 1e-12);
+        auto [kurtosis_merged, kurtosis_serial] = getMergedAndSerialState<SummarizerKurtosis<0, int>>(data, split);
+        EXPECT_NEAR(kurtosis_merged, kurtosis_serial, 1e-12);
+        auto [count_if_merged, count_if_serial] = getMergedAndSerialState<SummarizerCountIf<1, bool>>(data, split);
+        EXPECT_EQ(count_if_merged, count_if_serial);
+        auto [count_if_not_merged, count_if_not_serial] = getMergedAndSerialState<SummarizerCountIfNot<1, bool>>(data, split);
+        EXPECT_EQ(count_if_not_merged, count_if_not_serial);
+    }
+}
+
+TEST(DataFrameSummarize, SummarizerFused) {
+    auto data = std::make_tuple(std::vector<int>{4, -2, 9, 7, 1, 12, -5, 3, 8, 0});
+    using Fused = SummarizerFused<0, int, FusedFeatures{.sum = true, .min = true, .max = true, .moment_order = 4}>;
+    const auto sample_variance = getMergedAndSerialState<SummarizerSampleVariance<0, int>>(data, 0).second;
+    const auto skewness = getMergedAndSerialState<SummarizerSkewness<0, int>>(data, 0).second;
+    const auto kurtosis = getMergedAndSerialState<SummarizerKurtosis<0, int>>(data, 0).second;
+    for (std::size_t split : {0, 3, 10}) {
+        Fused fused{}, other{};
+        fused.summarizeRange(data, 0, split);
+        for (auto i = split; i < 10; ++i) {
+            other.summarize(data, i);
+        }
+        fused.merge(other);
+
+        EXPECT_EQ((fused.getStateOf<SummarizerSum<0, int>>()), 37);
+        EXPECT_EQ((fused.getStateOf<SummarizerMin<0, int>>()), -5);
+        EXPECT_EQ((fused.getStateOf<SummarizerMax<0, int>>()), 12);
+        EXPECT_DOUBLE_EQ((fused.getStateOf<SummarizerAvg<0, int>>()), 3.7);
+        EXPECT_DOUBLE_EQ((fused.getStateOf<SummarizerSampleVariance<0, int>>()), sample_variance);
+        EXPECT_NEAR((fused.getStateOf<SummarizerSkewness<0, int>>()), skewness, 1e-12);
+        EXPECT_NEAR((fused.getStateOf<SummarizerKurtosis<0, int>>()), kurtosis, 1e-12);
+    }
+
+    SummarizerFused<0, int, FusedFeatures{.moment_order = 1}> mean_only{};
+    mean_only.summarizeRange(data, 0, 10);
+    EXPECT_DOUBLE_EQ((mean_only.getStateOf<SummarizerAvg<0, int>>()), 3.7);
+}
+
+TEST(DataFrameSummarize, SummarizerTopK) {
+    auto data = std::make_tuple(std::vector<double>{4.0, 9.0, std::numeric_limits<double>::quiet_NaN(), 7.0, 9.0, 1.0, 12.0, 3.0});
+    SummarizerTopK<0, double, 3, SortOrder::Descending> top{}, other{};
+    for (auto i = 0LU; i < 4; ++i) {
+        top.summarize(data, i);
+    }
+    for (auto i = 4LU; i < 8; ++i) {
+        other.summarize(data, i);
+    }
+    EXPECT_THAT(top.getState(), ::testing::ElementsAre(1, 3, 0));
+    top.merge(other);
+    // ties are resolved by the row index
+    EXPECT_THAT(top.getState(), ::testing::ElementsAre(6, 1, 4));
+
+    SummarizerTopK<0, double, 10, SortOrder::Ascending> bottom{};
+    for (auto i = 0LU; i < 8; ++i) {
+        bottom.summarize(data, i);
+    }
+    EXPECT_THAT(bottom.getState(), ::testing::ElementsAre(5, 7, 0, 3, 1, 4, 6));
+}
+
+TEST(DataFrameSummarize, SummarizationExecuterGroupByMerge) {
+    auto data = std::make_tuple(std::vector<int>{3, 1, 3, 2, 5, 1, 2});
+    using Executer = SummarizationExecuterGroupBy<void, std::integer_sequence<std::size_t, 0>, std::tuple<int>, CompoundSummarizer<>>;
+
+    Executer executer{};
+    Executer other_executer{};
+    for (auto i = 0LU; i < 3; ++i) {
+        executer.getOrCreateGroupIndex(data, i);
+    }
+    for (auto i = 3LU; i < 7; ++i) {
+        other_executer.getOrCreateGroupIndex(data, i);
+    }
+    executer.merge(std::move(other_executer));
+    EXPECT_EQ(executer.getNumGroups(), 4);
+
+    // groups of the merged executer come after the existing groups in their order
+    std::vector<std::size_t> group_indices{};
+    for (auto i = 0LU; i < 7; ++i) {
+        group_indices.push_back(executer.getOrCreateGroupIndex(data, i));
+    }
+    EXPECT_THAT(group_indices, ::testing::ElementsAre(0, 1, 0, 2, 3, 1, 2));
+}
+
+TEST(DataFrameSummarize, SummarizationExecuterGroupBySortedRuns) {
+    using Executer = SummarizationExecuterGroupBy<void, std::integer_sequence<std::size_t, 0>, std::tuple<int>, CompoundSummarizer<>, SummarizeStrategy::SortedRuns>;
+
+    auto data = std::make_tuple(std::vector<int>{1, 1, 2, 2, 2, 5, 7, 7});
+    Executer executer{};
+    std::vector<std::size_t> group_indices{};
+    for (auto i = 0LU; i < 8; ++i) {
+        group_indices.push_back(executer.getOrCreateGroupIndex(data, i));
+    }
+    EXPECT_THAT(group_indices, ::testing::ElementsAre(0, 0, 1, 1, 1, 2, 3, 3));
+
+    // a run split between two executers becomes a single group
+    Executer first_executer{};
+    Executer second_executer{};
+    for (auto i = 0LU; i < 4; ++i) {
+        first_executer.getOrCreateGroupIndex(data, i);
+    }
+    for (auto i = 4LU; i < 8; ++i) {
+        second_executer.getOrCreateGroupIndex(data, i);
+    }
+    first_executer.merge(std::move(second_executer));
+    EXPECT_EQ(first_executer.getNumGroups(), 4);
+
+    auto descending_data = std::make_tuple(std::vector<int>{9, 9, 4, 1});
+    Executer descending_executer{};
+    for (auto i = 0LU; i < 4; ++i) {
+        descending_executer.getOrCreateGroupIndex(descending_data, i);
+    }
+    EXPECT_EQ(descending_executer.getNumGroups(), 3);
+
+    auto unsorted_data = std::make_tuple(std::vector<int>{1, 2, 1});
+    Executer unsorted_executer{};
+    unsorted_executer.getOrCreateGroupIndex(unsorted_data, 0);
+    unsorted_executer.getOrCreateGroupIndex(unsorted_data, 1);
+    EXPECT_THROW(unsorted_executer.getOrCreateGroupIndex(unsorted_data, 2), SummarizeException);
+
+    // the boundary between executers is checked on merge
+    Executer ascending_executer{};
+    ascending_executer.getOrCreateGroupIndex(data, 5);
+    ascending_executer.getOrCreateGroupIndex(data, 6);
+    Executer other_executer{};
+    other_executer.getOrCreateGroupIndex(data, 0);
+    EXPECT_THROW(ascending_executer.merge(std::move(other_executer)), SummarizeException);
+}
+
+TEST(DataFrameSummarize, GetKeyDomain) {
+    EXPECT_TRUE((std::is_same_v<GetKeyDomain<GroupBy<"a">, std::tuple<bool>>, KeyDomain<0, 2>>));
+    EXPECT_TRUE((std::is_same_v<GetKeyDomain<GroupBy<"a">, std::tuple<signed char>>, KeyDomain<-128, 128>>));
+    EXPECT_TRUE((std::is_same_v<GetKeyDomain<GroupBy<"a">, std::tuple<unsigned char>>, KeyDomain<0, 256>>));
+    EXPECT_TRUE((std::is_same_v<GetKeyDomain<GroupByDomain<"a", -4, 12>, std::tuple<int>>, KeyDomain<-4, 12>>));
+    EXPECT_TRUE((std::is_same_v<GetKeyDomain<GroupBy<"a">, std::tuple<int>>, NoKeyDomain>));
+    EXPECT_TRUE((std::is_same_v<GetKeyDomain<GroupBy<"a", "b">, std::tuple<bool, bool>>, NoKeyDomain>));
+}
+
+TEST(DataFrameSummarize, SummarizationExecuterGroupByKeyDomain) {
+    using Executer = SummarizationExecuterGroupBy<void, std::integer_sequence<std::size_t, 0>, std::tuple<int>, CompoundSummarizer<>, SummarizeStrategy::Hash, KeyDomain<-2, 6>>;
+
+    auto data = std::make_tuple(std::vector<int>{3, -2, 3, 5, -2, 0, 5, 9});
+    Executer executer{};
+    std::vector<std::size_t> group_indices{};
+    for (auto i = 0LU; i < 7; ++i) {
+        group_indices.push_back(executer.getOrCreateGroupIndex(data, i));
+    }
+    // groups are ordered by their first appearance
+    EXPECT_THAT(group_indices, ::testing::ElementsAre(0, 1, 0, 2, 1, 3, 2));
+    EXPECT_THROW(executer.getOrCreateGroupIndex(data, 7), SummarizeException);
+
+    Executer other_executer{};
+    other_executer.getOrCreateGroupIndex(data, 5);
+    other_executer.getOrCreateGroupIndex(data, 0);
+    Executer merged_executer{};
+    merged_executer.getOrCreateGroupIndex(data, 0);
+    merged_executer.merge(std::move(other_executer));
+    EXPECT_EQ(merged_executer.getNumGroups(), 2);
+    EXPECT_EQ(merged_executer.getOrCreateGroupIndex(data, 5), 1);
+}
@@ -0,0 +1,66 @@
+// Copyright 2022 Andi Hellmund
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <span>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "data_crunching/internal/dataframe_window.hpp"
+
+using namespace dacr;
+using namespace dacr::internal;
+
+TEST(DataFrameWindow, AreValidWindowOps) {
+    EXPECT_TRUE((are_valid_window_ops<TypeList<RowNumber<"rn">, Lag<"a", "prev_a">, CumSum<"b", "cum_b">>, Column<"a", std::string>, Column<"b", int>>));
+    EXPECT_FALSE((are_valid_window_ops<TypeList<Lead<"c", "next_c">>, Column<"a", std::string>, Column<"b", int>>));
+}
+
+TEST(DataFrameWindow, GetNewColumnsForWindowOps) {
+    EXPECT_TRUE((std::is_same_v<
+        GetNewColumnsForWindowOps<
+            TypeList<RowNumber<"rn">, DenseRank<"dr">, Lead<"a", "next_a", 2>, CumSum<"b", "cum_b">>,
+            Column<"a", std::string>,
+            Column<"b", int>
+        >,
+        TypeList<
+            Column<"rn", std::size_t>,
+            Column<"dr", std::size_t>,
+            Column<"next_a", std::string>,
+            Column<"cum_b", int>
+        >
+    >));
+}
+
+TEST(DataFrameWindow, WindowExecuter) {
+    auto data = std::make_tuple(std::vector<int>{30, 10, 20, 10, 30}, std::vector<double>{1.0, 2.0, 3.0, 4.0, 5.0});
+    using ElementComparison = ConstructElementComparison<SortOrder::Ascending, std::integer_sequence<std::size_t, 0>>;
+    WindowExecuter<ElementComparison, WindowRowNumber, WindowRank, WindowDenseRank, WindowShift<1, double, -1>, WindowShift<1, double, 1>, WindowCumSum<1, double>> executer{5};
+
+    std::vector<std::size_t> row_indices{0, 1, 2, 3, 4};
+    executer.evaluatePartition(data, std::span<std::size_t>{row_indices});
+    EXPECT_THAT(row_indices, ::testing::ElementsAre(1, 3, 2, 0, 4));
+
+    const auto& [row_numbers, ranks, dense_ranks, lags, leads, cum_sums] = executer.getResults();
+    EXPECT_THAT(row_numbers, ::testing::ElementsAre(4, 1, 3, 2, 5));
+    EXPECT_THAT(ranks, ::testing::ElementsAre(4, 1, 3, 1, 4));
+    EXPECT_THAT(dense_ranks, ::testing::ElementsAre(3, 1, 2, 1, 3));
+    EXPECT_THAT(lags, ::testing::ElementsAre(3.0, 0.0, 4.0, 2.0, 1.0));
+    EXPECT_THAT(leads, ::testing::ElementsAre(5.0, 4.0, 1.0, 3.0, 0.0));
+    EXPECT_THAT(cum_sums, ::testing::ElementsAre(10.0, 2.0, 9.0, 6.0, 15.0));
+}
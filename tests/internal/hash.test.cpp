@@ -0,0 +1,54 @@
+// Copyright 2022 Andi Hellmund
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "data_crunching/internal/hash.hpp"
+
+using namespace dacr;
+using namespace dacr::internal;
+
+struct NotHashable {};
+
+TEST(Hash, AreTypesHashable) {
+    EXPECT_TRUE((are_types_hashable<TypeList<int, char, std::string, double, bool>>));
+    EXPECT_TRUE((are_types_hashable<TypeList<>>));
+    EXPECT_FALSE((are_types_hashable<TypeList<int, NotHashable>>));
+}
+
+TEST(Hash, MixHash) {
+    EXPECT_NE(mixHash(1), 1);
+    EXPECT_NE(mixHash(1), mixHash(2));
+    EXPECT_EQ(mixHash(42), mixHash(42));
+}
+
+TEST(Hash, HashColumnStoreRow) {
+    auto column_store_data = std::make_tuple(
+        std::vector<int>{10, 20, 10},
+        std::vector<std::string>{"a", "a", "a"},
+        std::vector<double>{1.0, 2.0, 3.0}
+    );
+    using KeyIndices = std::integer_sequence<std::size_t, 0, 1>;
+    EXPECT_EQ(hashColumnStoreRow(column_store_data, 0, KeyIndices{}), hashColumnStoreRow(column_store_data, 2, KeyIndices{}));
+    EXPECT_NE(hashColumnStoreRow(column_store_data, 0, KeyIndices{}), hashColumnStoreRow(column_store_data, 1, KeyIndices{}));
+    EXPECT_NE(
+        hashColumnStoreRow(column_store_data, 0, std::integer_sequence<std::size_t, 0, 2>{}),
+        hashColumnStoreRow(column_store_data, 2, std::integer_sequence<std::size_t, 0, 2>{})
+    );
+}
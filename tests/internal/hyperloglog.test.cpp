@@ -0,0 +1,64 @@
+// Copyright 2022 Andi Hellmund
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <cstdint>
+
+#include "data_crunching/internal/hash.hpp"
+#include "data_crunching/internal/hyperloglog.hpp"
+
+using namespace dacr;
+using namespace dacr::internal;
+
+TEST(HyperLogLog, Empty) {
+    HyperLogLog<12> sketch{};
+    EXPECT_DOUBLE_EQ(sketch.getEstimate(), 0.0);
+}
+
+TEST(HyperLogLog, SmallCardinality) {
+    HyperLogLog<12> sketch{};
+    for (auto repetition = 0; repetition < 3; ++repetition) {
+        for (std::uint64_t key = 0; key < 100; ++key) {
+            sketch.insert(mixHash(key));
+        }
+    }
+    EXPECT_NEAR(sketch.getEstimate(), 100.0, 2.0);
+}
+
+TEST(HyperLogLog, LargeCardinality) {
+    HyperLogLog<12> sketch{};
+    for (std::uint64_t key = 0; key < 1'000'000; ++key) {
+        sketch.insert(mixHash(key));
+    }
+    // standard error is about 1.6%, such that 5% is above three standard errors
+    EXPECT_NEAR(sketch.getEstimate(), 1'000'000.0, 50'000.0);
+}
+
+TEST(HyperLogLog, Merge) {
+    HyperLogLog<10> sketch{};
+    HyperLogLog<10> other_sketch{};
+    HyperLogLog<10> all_sketch{};
+    for (std::uint64_t key = 0; key < 50'000; ++key) {
+        (key < 30'000 ? sketch : other_sketch).insert(mixHash(key));
+        all_sketch.insert(mixHash(key));
+    }
+    // overlapping keys do not count twice
+    for (std::uint64_t key = 20'000; key < 30'000; ++key) {
+        other_sketch.insert(mixHash(key));
+    }
+    sketch.merge(other_sketch);
+    EXPECT_DOUBLE_EQ(sketch.getEstimate(), all_sketch.getEstimate());
+}
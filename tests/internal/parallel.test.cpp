@@ -0,0 +1,51 @@
+// Copyright 2022 Andi Hellmund
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include "data_crunching/internal/parallel.hpp"
+
+using namespace dacr::internal;
+
+TEST(Parallel, GetNumThreads) {
+    EXPECT_GE(getNumThreads(0), 1);
+    EXPECT_EQ(getNumThreads(3), 3);
+}
+
+TEST(Parallel, ParallelForExecutesAllTasks) {
+    std::vector<int> executed(1000, 0);
+    parallelFor(executed.size(), 4, [&executed](std::size_t task_index) {
+        executed[task_index] += 1;
+    });
+    EXPECT_TRUE(std::ranges::all_of(executed, [](int count) { return count == 1; }));
+
+    std::atomic<int> num_executed {0};
+    parallelFor(0, 4, [&num_executed](std::size_t) {
+        ++num_executed;
+    });
+    EXPECT_EQ(num_executed, 0);
+}
+
+TEST(Parallel, ParallelForRethrowsException) {
+    EXPECT_THROW(parallelFor(100, 4, [](std::size_t task_index) {
+        if (task_index == 42) {
+            throw std::runtime_error("task failed");
+        }
+    }), std::runtime_error);
+}
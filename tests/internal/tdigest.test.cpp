@@ -0,0 +1,72 @@
+// Copyright 2022 Andi Hellmund
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <cmath>
+#include <random>
+
+#include "data_crunching/internal/tdigest.hpp"
+
+using namespace dacr;
+using namespace dacr::internal;
+
+TEST(TDigest, Empty) {
+    TDigest<100> digest{};
+    digest.compress();
+    EXPECT_TRUE(std::isnan(digest.getQuantile(0.5)));
+}
+
+TEST(TDigest, FewValues) {
+    TDigest<100> digest{};
+    for (auto value : {3.0, 1.0, 2.0}) {
+        digest.insert(value);
+    }
+    digest.compress();
+    EXPECT_EQ(digest.getNumCentroids(), 3);
+    EXPECT_DOUBLE_EQ(digest.getQuantile(0.0), 1.0);
+    EXPECT_DOUBLE_EQ(digest.getQuantile(0.5), 2.0);
+    EXPECT_DOUBLE_EQ(digest.getQuantile(1.0), 3.0);
+}
+
+TEST(TDigest, UniformQuantiles) {
+    TDigest<100> digest{};
+    std::mt19937 generator{7};
+    std::uniform_real_distribution<double> distribution{0.0, 1000.0};
+    for (auto i = 0; i < 100'000; ++i) {
+        digest.insert(distribution(generator));
+    }
+    digest.compress();
+    EXPECT_LE(digest.getNumCentroids(), 100);
+    EXPECT_NEAR(digest.getQuantile(0.5), 500.0, 10.0);
+    EXPECT_NEAR(digest.getQuantile(0.95), 950.0, 3.0);
+    EXPECT_NEAR(digest.getQuantile(0.99), 990.0, 1.0);
+    EXPECT_NEAR(digest.getQuantile(0.001), 1.0, 0.5);
+}
+
+TEST(TDigest, Merge) {
+    TDigest<100> digest{};
+    std::vector<TDigest<100>> partial_digests(4);
+    for (auto i = 0; i < 40'000; ++i) {
+        partial_digests[i % 4].insert(static_cast<double>(i));
+    }
+    for (const auto& partial_digest : partial_digests) {
+        digest.merge(partial_digest);
+    }
+    digest.compress();
+    EXPECT_NEAR(digest.getQuantile(0.5), 20'000.0, 200.0);
+    EXPECT_NEAR(digest.getQuantile(0.99), 39'600.0, 40.0);
+    EXPECT_DOUBLE_EQ(digest.getQuantile(1.0), 39'999.0);
+}
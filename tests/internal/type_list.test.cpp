@@ -48,3 +48,15 @@ TEST(TypeList, ConvertTypeListToTuple) {
         std::tuple<int, double>
     >));
 }
+
+TEST(TypeList, Index) {
+    EXPECT_EQ((type_list_index<int, TypeList<int>>), 0);
+    EXPECT_EQ((type_list_index<double, TypeList<int, char, double>>), 2);
+    EXPECT_EQ((type_list_index<char, TypeList<int, char, char>>), 1);
+}
+
+TEST(TypeList, Unique) {
+    EXPECT_TRUE((std::is_same_v<TypeListUnique<TypeList<>>, TypeList<>>));
+    EXPECT_TRUE((std::is_same_v<TypeListUnique<TypeList<int, double>>, TypeList<int, double>>));
+    EXPECT_TRUE((std::is_same_v<TypeListUnique<TypeList<int, double, int, char, double>>, TypeList<int, double, char>>));
+}
@@ -17,6 +17,7 @@
 
 #include <type_traits>
 #include <array>
+#include <string>
 
 #include "data_crunching/internal/type_list.hpp"
 #include "data_crunching/internal/utils.hpp"
@@ -46,6 +47,14 @@ TEST(TypeList, IsConvertibleTo) {
     EXPECT_FALSE((is_convertible_to<TypeList<int>, TypeList<NonConvertibleTo>>));
 }
 
+TEST(TypeList, AreTypesLessThanComparable) {
+    EXPECT_TRUE((are_types_less_than_comparable<TypeList<>>));
+    EXPECT_TRUE((are_types_less_than_comparable<TypeList<int, double, std::string>>));
+
+    struct NonComparable{};
+    EXPECT_FALSE((are_types_less_than_comparable<TypeList<int, NonComparable>>));
+}
+
 TEST(Ranges, ExtractValueTypes) {
     EXPECT_TRUE((std::is_same_v<
         ExtractValueTypesFromRanges<>,